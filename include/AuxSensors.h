@@ -0,0 +1,86 @@
+#ifndef AUX_SENSORS_H
+#define AUX_SENSORS_H
+
+#include <cstddef>
+#include <cstdint>
+
+#define AUX_MAX_SLAVES      4  // I2C_SLV0..3, slave 4 has no data registers of its own
+#define AUX_MAX_BYTES       24 // EXT_SENS_DATA_00..23
+#define AUX_MAX_LENGTH      14 // longest even I2C_SLVx_LEN (4 bits)
+#define AUX_MASTER_400KHZ   13 // I2C_MST_CLK, see MPU6050_Base::setMasterClockSpeed
+
+/**
+ * An external sensor on the MPU6050's auxiliary bus (XDA/XCL). The MPU6050 reads length bytes from reg of the
+ * slave at address every sample and pushes them into its FIFO right behind the gyro, in slave order.
+ * Every two bytes are one int16 channel, length must be even. littleEndian slaves (e.g. AK8963) get their
+ * byte pairs swapped by the MPU6050, so every channel arrives big endian like the ImuChannels.
+ */
+struct AuxSlave {
+    uint8_t address;
+    uint8_t reg;
+    uint8_t length;
+    bool littleEndian;
+};
+
+// Register write done once at setup, e.g. to put a magnetometer into continuous measurement mode
+struct AuxRegisterWrite {
+    uint8_t address;
+    uint8_t reg;
+    uint8_t value;
+};
+
+// Bytes the slaves add to every FIFO frame
+constexpr size_t auxFrameBytes(const AuxSlave *slaves, uint8_t count) {
+    size_t bytes = 0;
+    for (uint8_t i = 0; i < count; i++) bytes += slaves[i].length;
+    return bytes;
+}
+
+inline bool validAuxSlaves(const AuxSlave *slaves, uint8_t count) {
+    if (count > AUX_MAX_SLAVES || auxFrameBytes(slaves, count) > AUX_MAX_BYTES) return false;
+    for (uint8_t i = 0; i < count; i++) {
+        if (slaves[i].length == 0 || slaves[i].length > AUX_MAX_LENGTH || (slaves[i].length & 1)) return false;
+        if (slaves[i].address > 0x7F) return false;
+    }
+    return true;
+}
+
+// Let the MPU6050 read the slaves into its FIFO. The init writes go straight to the slaves through the bypass
+// (write(address, reg, value) on the ESP32's bus) before the MPU6050 takes over the auxiliary bus as its master.
+// "Device" is MPU6050_Base on the ESP32. Call before FifoAcquisition::begin() with auxFrameBytes() as auxBytes,
+// the FIFO reset there drops frames from before the slaves were set up. Returns false for an invalid configuration
+// or a failed init write
+template<class Device, class Write>
+bool beginAuxSlaves(Device &device, const AuxSlave *slaves, uint8_t count,
+                    const AuxRegisterWrite *init, size_t initCount, Write write) {
+    if (!validAuxSlaves(slaves, count)) return false;
+    device.setI2CMasterModeEnabled(false);
+    device.setI2CBypassEnabled(true);
+    bool ok = true;
+    for (size_t i = 0; i < initCount && ok; i++) ok = write(init[i].address, init[i].reg, init[i].value);
+    device.setI2CBypassEnabled(false);
+    if (!ok) return false;
+
+    device.setMasterClockSpeed(AUX_MASTER_400KHZ);
+    device.setWaitForExternalSensorEnabled(true); // data ready (and the FIFO write) waits for the slaves, frames stay complete
+    for (uint8_t i = 0; i < AUX_MAX_SLAVES; i++) {
+        bool used = i < count;
+        if (used) {
+            device.setSlaveAddress(i, 0x80 | slaves[i].address); // bit 7: read
+            device.setSlaveRegister(i, slaves[i].reg);
+            device.setSlaveDataLength(i, slaves[i].length);
+            device.setSlaveWordByteSwap(i, slaves[i].littleEndian);
+        }
+        device.setSlaveEnabled(i, used);
+        switch (i) {
+            case 0: device.setSlave0FIFOEnabled(used); break;
+            case 1: device.setSlave1FIFOEnabled(used); break;
+            case 2: device.setSlave2FIFOEnabled(used); break;
+            case 3: device.setSlave3FIFOEnabled(used); break;
+        }
+    }
+    device.setI2CMasterModeEnabled(count > 0);
+    return true;
+}
+
+#endif // AUX_SENSORS_H
@@ -0,0 +1,133 @@
+#ifndef BASE91_H
+#define BASE91_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Base91 alphabet. The " character of the standard alphabet is replaced with ',
+// because we cannot send " in json file safely or it might be interpreted wrongfully
+constexpr char BASE91_ALPHABET[92] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789!#$%&()*+,./:;<=>?@[]^_`{|}~'";
+
+// Reverse lookup for the decoder, 91 marks characters that are not part of the alphabet
+constexpr uint8_t BASE91_DECODE[256] = {
+    91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+    91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+    91, 62, 91, 63, 64, 65, 66, 90, 67, 68, 69, 70, 71, 91, 72, 73,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 74, 75, 76, 77, 78, 79,
+    80,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 81, 91, 82, 83, 84,
+    85, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+    41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 86, 87, 88, 89, 91,
+    91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+    91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+    91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+    91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+    91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+    91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+    91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+    91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+};
+
+// Upper bound for the number of characters base91Encode writes for "length" bytes.
+// Every pair of characters carries at least 13 bits, plus up to two characters for the remainder
+constexpr size_t base91EncodedMaxLength(size_t length) {
+    return (length * 16 + 12) / 13 + 2;
+}
+
+// Upper bound for the number of bytes base91Decode writes for "length" characters
+constexpr size_t base91DecodedMaxLength(size_t length) {
+    return (length * 14) / 16 + 1;
+}
+
+/**
+ * Encodes "length" bytes into base91 and writes the characters to "out", which has to hold
+ * at least base91EncodedMaxLength(length) characters (e.g. a region reserved in the HTTP body).
+ * No terminating zero is written. Returns the number of characters written.
+ * The bit buffer is refilled 32 bits at a time, the input bytes are consumed directly.
+ */
+inline size_t base91Encode(const uint8_t *data, size_t length, char *out) {
+    char *start = out;
+    uint64_t bit_buffer = 0;
+    unsigned int num_bits = 0;
+    size_t i = 0;
+
+    while (i < length) {
+        // Refill: at most 13 bits are pending here, so 32 more always fit
+        if (length - i >= 4) {
+            uint32_t word = (uint32_t)data[i] | ((uint32_t)data[i + 1] << 8) |
+                            ((uint32_t)data[i + 2] << 16) | ((uint32_t)data[i + 3] << 24);
+            bit_buffer |= (uint64_t)word << num_bits;
+            num_bits += 32;
+            i += 4;
+        } else {
+            bit_buffer |= (uint64_t)data[i++] << num_bits;
+            num_bits += 8;
+        }
+
+        while (num_bits > 13) {
+            unsigned int value = bit_buffer & 8191; // take the lowest 13 bits
+            if (value > 88) { // 13 bits fill only 8192 values, but base91 has 8281 values available.
+                              // Sometimes we need to borrow one bit to not waste space
+                bit_buffer >>= 13;
+                num_bits -= 13;
+            } else { // We use 14 bits for two characters
+                value = bit_buffer & 16383;
+                bit_buffer >>= 14;
+                num_bits -= 14;
+            }
+            *out++ = BASE91_ALPHABET[value % 91]; // remainder for first character
+            *out++ = BASE91_ALPHABET[value / 91]; // quotient for second character
+        }
+    }
+
+    // There may be fewer than 13 bits left
+    if (num_bits > 0) {
+        *out++ = BASE91_ALPHABET[bit_buffer % 91];
+        if (num_bits > 7 || bit_buffer > 90) {
+            *out++ = BASE91_ALPHABET[bit_buffer / 91];
+        }
+    }
+
+    return out - start;
+}
+
+/**
+ * Decodes "length" base91 characters into "out", which has to hold at least
+ * base91DecodedMaxLength(length) bytes. Characters outside of the alphabet are skipped.
+ * Returns the number of bytes written. Meant for the receiving side.
+ */
+inline size_t base91Decode(const char *data, size_t length, uint8_t *out) {
+    uint8_t *start = out;
+    uint64_t bit_buffer = 0;
+    unsigned int num_bits = 0;
+    int value = -1;
+
+    for (size_t i = 0; i < length; i++) {
+        unsigned int d = BASE91_DECODE[(uint8_t)data[i]];
+        if (d == 91) continue;
+        if (value < 0) { // first character of a pair
+            value = d;
+            continue;
+        }
+        value += d * 91;
+        bit_buffer |= (uint64_t)value << num_bits;
+        num_bits += (value & 8191) > 88 ? 13 : 14;
+        while (num_bits >= 8) {
+            *out++ = (uint8_t)bit_buffer;
+            bit_buffer >>= 8;
+            num_bits -= 8;
+        }
+        value = -1;
+    }
+
+    // A single trailing character completes the last byte
+    if (value >= 0) {
+        *out++ = (uint8_t)(bit_buffer | ((uint64_t)value << num_bits));
+    }
+
+    return out - start;
+}
+
+#endif // BASE91_H
@@ -0,0 +1,147 @@
+#ifndef CALIBRATION_STORE_H
+#define CALIBRATION_STORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include "Imu.h"
+#include "Packet.h"
+
+// Stored calibration record, all integers little endian (putU16 / putU32 from Packet.h).
+//
+//  offset  size  field
+//  0       2     magic "CL"
+//  2       1     version (CALIBRATION_VERSION)
+//  3       1     I2C address of the sensor
+//  4       1     WHO_AM_I
+//  5       6     factory self-test trims: accel X/Y/Z, gyro X/Y/Z
+//  11      12    offset registers: accel X/Y/Z, gyro X/Y/Z (int16, MPU6050_Base::GetActiveOffsets order)
+//  23      2     raw TEMP_OUT when the offsets converged
+//  25      4     CRC-32 of bytes 0..24
+#define CALIBRATION_MAGIC_0     'C'
+#define CALIBRATION_MAGIC_1     'L'
+#define CALIBRATION_VERSION     1
+#define CALIBRATION_RECORD_SIZE 29
+
+/**
+ * Identifies the sensor a calibration belongs to. The MPU6050 has no serial number, but the factory
+ * self-test trims differ from unit to unit, together with the address and WHO_AM_I they tell a swapped
+ * sensor apart well enough to not apply its predecessor's offsets.
+ */
+struct DeviceFingerprint {
+    uint8_t address;
+    uint8_t deviceId;
+    uint8_t trims[6];
+};
+
+inline bool operator==(const DeviceFingerprint &a, const DeviceFingerprint &b) {
+    if (a.address != b.address || a.deviceId != b.deviceId) return false;
+    for (size_t i = 0; i < 6; i++) if (a.trims[i] != b.trims[i]) return false;
+    return true;
+}
+
+// Converged offsets of one sensor and the temperature they were found at
+struct CalibrationRecord {
+    DeviceFingerprint device;
+    int16_t offsets[6];
+    int16_t temperature;
+};
+
+enum CalibrationStatus : uint8_t {
+    CALIBRATION_MISSING,      // nothing stored, or the record is corrupt
+    CALIBRATION_OTHER_DEVICE, // stored for a different sensor, useless
+    CALIBRATION_STALE,        // right sensor, but too far from the calibration temperature: a good starting point only
+    CALIBRATION_VALID,        // restore and use as is
+};
+
+// CRC-32 (IEEE 802.3, reflected), bitwise: records are tiny and written once
+inline uint32_t calibrationCRC32(const uint8_t *data, size_t length) {
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+    return ~crc;
+}
+
+inline void encodeCalibration(const CalibrationRecord &record, uint8_t *out) {
+    out[0] = CALIBRATION_MAGIC_0;
+    out[1] = CALIBRATION_MAGIC_1;
+    out[2] = CALIBRATION_VERSION;
+    out[3] = record.device.address;
+    out[4] = record.device.deviceId;
+    for (size_t i = 0; i < 6; i++) out[5 + i] = record.device.trims[i];
+    for (size_t i = 0; i < 6; i++) putU16(out + 11 + 2 * i, (uint16_t)record.offsets[i]);
+    putU16(out + 23, (uint16_t)record.temperature);
+    putU32(out + 25, calibrationCRC32(out, 25));
+}
+
+// Returns false for anything but an intact record of this version
+inline bool decodeCalibration(const uint8_t *data, size_t size, CalibrationRecord &record) {
+    if (size < CALIBRATION_RECORD_SIZE) return false;
+    if (data[0] != CALIBRATION_MAGIC_0 || data[1] != CALIBRATION_MAGIC_1 || data[2] != CALIBRATION_VERSION) return false;
+    if (getU32(data + 25) != calibrationCRC32(data, 25)) return false;
+    record.device.address = data[3];
+    record.device.deviceId = data[4];
+    for (size_t i = 0; i < 6; i++) record.device.trims[i] = data[5 + i];
+    for (size_t i = 0; i < 6; i++) record.offsets[i] = (int16_t)getU16(data + 11 + 2 * i);
+    record.temperature = (int16_t)getU16(data + 23);
+    return true;
+}
+
+// How much a stored record is worth for the sensor at hand. stored is nullptr when nothing could be loaded
+inline CalibrationStatus checkCalibration(const CalibrationRecord *stored, const DeviceFingerprint &device,
+                                          int16_t temperature, float maxDriftCelsius) {
+    if (!stored) return CALIBRATION_MISSING;
+    if (!(stored->device == device)) return CALIBRATION_OTHER_DEVICE;
+    float drift = tempToCelsius(temperature) - tempToCelsius(stored->temperature);
+    if (drift > maxDriftCelsius || drift < -maxDriftCelsius) return CALIBRATION_STALE;
+    return CALIBRATION_VALID;
+}
+
+/**
+ * Where a calibration record lives between boots: NVS on the ESP32, a file on the host.
+ * read() succeeds only if exactly length bytes were read.
+ */
+class CalibrationStorage {
+public:
+    virtual ~CalibrationStorage() {}
+    virtual bool read(uint8_t *data, size_t length) = 0;
+    virtual bool write(const uint8_t *data, size_t length) = 0;
+};
+
+class FileCalibrationStorage : public CalibrationStorage {
+public:
+    FileCalibrationStorage(const char *path) : path(path) {}
+
+    bool read(uint8_t *data, size_t length) override {
+        FILE *f = fopen(path, "rb");
+        if (!f) return false;
+        size_t n = fread(data, 1, length, f);
+        fclose(f);
+        return n == length;
+    }
+
+    bool write(const uint8_t *data, size_t length) override {
+        FILE *f = fopen(path, "wb");
+        if (!f) return false;
+        size_t n = fwrite(data, 1, length, f);
+        return fclose(f) == 0 && n == length;
+    }
+
+private:
+    const char *path;
+};
+
+inline bool loadCalibration(CalibrationStorage &storage, CalibrationRecord &record) {
+    uint8_t data[CALIBRATION_RECORD_SIZE];
+    return storage.read(data, sizeof(data)) && decodeCalibration(data, sizeof(data), record);
+}
+
+inline bool saveCalibration(CalibrationStorage &storage, const CalibrationRecord &record) {
+    uint8_t data[CALIBRATION_RECORD_SIZE];
+    encodeCalibration(record, data);
+    return storage.write(data, sizeof(data));
+}
+
+#endif // CALIBRATION_STORE_H
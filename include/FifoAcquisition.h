@@ -0,0 +1,234 @@
+#ifndef FIFO_ACQUISITION_H
+#define FIFO_ACQUISITION_H
+
+#include <cstddef>
+#include <cstdint>
+#include "I2cEngine.h"
+#include "Imu.h"
+
+#ifndef MPU6050_FIFO_SIZE
+#define MPU6050_FIFO_SIZE       1024
+#endif
+#define FIFO_FRAME_SIZE         14 // accel (6), temperature (2), gyro (6), big endian. Auxiliary sensors add to it
+#define FIFO_TEMP_SIZE          2  // left out when the temperature is read on its own
+#define FIFO_MAX_AUX_BYTES      24 // EXT_SENS_DATA_00..23
+#define FIFO_COUNT_REGISTER     0x72 // MPU6050_RA_FIFO_COUNTH, big endian count follows in 0x73
+#define FIFO_DATA_REGISTER      0x74 // MPU6050_RA_FIFO_R_W
+#define FIFO_MAX_BURST          255 // bytes per I2cTransaction, the length is 8 bits
+
+struct FifoStats {
+    uint32_t drains;        // calls to drain()
+    uint32_t frames;        // samples decoded
+    uint32_t overflows;     // FIFO ran full, the oldest frames were lost
+    uint32_t droppedFrames; // frames lost to overflows, estimated from the sample clock
+    uint32_t prefetched;    // frames read in the background by prefetch()
+};
+
+/**
+ * Hardware-timed acquisition from the MPU6050 FIFO. The sensor pushes one frame per sample period into its
+ * FIFO, drain() collects every complete frame with MPU6050_Base::getFIFOPackets() (one count read, then bursts
+ * of whole frames) and decodes them into one column per ImuChannel, followed by one per auxiliary channel when
+ * external sensors were set up with beginAuxSlaves(). A temperature that is read at a lower rate (ChannelRates) can be
+ * left out of the frames, its column is then not touched. Between drains the CPU is free.
+ * An overflow costs the frames the sensor overwrote but nothing else: the backlog is kept, the FIFO is not reset
+ * and frameTimes() estimates how many frames are missing so the timestamps stay on the sensor's grid.
+ * "Device" is MPU6050_Base on the ESP32, SimulatedMpu6050 or any class with the same FIFO methods on the host.
+ */
+template<class Device>
+class FifoAcquisition {
+public:
+    FifoAcquisition(Device &device)
+        : device(device), periodMicros(1000), frameSize(FIFO_FRAME_SIZE), withTemperature(true), stats(), framesSinceReset(0), epochMicros(0),
+          haveEpoch(false), overflowed(false),
+          prefetching(false), prefetchTarget(0), prefetchTotal(0), prefetchFrames(0), buffered(0), bufferedAt(0) {}
+
+    // Capture accel, temperature and gyro at (8kHz or 1kHz) / (1 + rateDivider), see samplePeriodMicros().
+    // auxBytes is what the auxiliary slaves add to every frame (auxFrameBytes() in AuxSensors.h), an even number.
+    // Without temperature the frames hold accel and gyro only and the temperature is up to the caller.
+    // Also to change the configuration later on, once prefetchPending() is false. Prefetched frames are dropped with the FIFO
+    void begin(uint8_t rateDivider, uint8_t dlpfMode, uint8_t auxBytes = 0, bool temperature = true) {
+        device.setFIFOEnabled(false);
+        device.setDLPFMode(dlpfMode);
+        device.setRate(rateDivider);
+        device.setAccelFIFOEnabled(true);
+        device.setTempFIFOEnabled(temperature);
+        device.setXGyroFIFOEnabled(true);
+        device.setYGyroFIFOEnabled(true);
+        device.setZGyroFIFOEnabled(true);
+        device.resetFIFO();
+        device.setFIFOEnabled(true);
+        periodMicros = samplePeriodMicros(rateDivider, dlpfMode);
+        prefetching = false;
+        buffered = 0;
+        withTemperature = temperature;
+        frameSize = (temperature ? FIFO_FRAME_SIZE : FIFO_FRAME_SIZE - FIFO_TEMP_SIZE) +
+                    (auxBytes < FIFO_MAX_AUX_BYTES ? auxBytes & ~1 : FIFO_MAX_AUX_BYTES);
+        restartClock();
+    }
+
+    // Time between two frames in microseconds
+    uint32_t samplePeriod() const { return periodMicros; }
+
+    // Bytes per frame and the int16 channels they hold: IMU_CHANNELS (without the temperature if left out) plus the auxiliary ones
+    uint8_t frameBytes() const { return frameSize; }
+    size_t channels() const { return frameSize / 2; }
+    bool temperatureInFrames() const { return withTemperature; }
+
+    // Number of complete frames waiting in the FIFO
+    size_t available() {
+        return device.getFIFOCount() / frameSize;
+    }
+
+    // Read up to maxFrames complete frames and write sample i to columns[channel][offset + i], channel < IMU_CHANNELS plus the
+    // auxiliary channels.
+    // Returns the number of frames read, after an overflow these are the frames that survived it.
+    size_t drain(int16_t *const *columns, size_t offset, size_t maxFrames) {
+        stats.drains++;
+        if (prefetching) {
+            if (prefetchTx.status() == I2C_PENDING) return 0; // still being read in the background, try again later
+            prefetching = false;
+            buffered = prefetchFrames; // whole frames that arrived before a failed burst are still good
+            bufferedAt = 0;
+            stats.prefetched += prefetchFrames;
+        }
+        if (buffered > 0) {
+            size_t n = buffered < maxFrames ? buffered : maxFrames;
+            decodeFrames(frameBuffer + bufferedAt * frameSize, n, frameSize, columns, offset, withTemperature);
+            bufferedAt += n;
+            buffered -= n;
+            stats.frames += n;
+            framesSinceReset += n;
+            return n;
+        }
+
+        if (maxFrames > maxFramesInFIFO()) maxFrames = maxFramesInFIFO();
+        bool lost = false;
+        size_t frames = device.getFIFOPackets(frameBuffer, frameSize, (uint16_t)maxFrames, &lost);
+        if (lost) {
+            stats.overflows++;
+            overflowed = true; // frameTimes() works out how many are missing
+        }
+        decodeFrames(frameBuffer, frames, frameSize, columns, offset, withTemperature);
+        stats.frames += frames;
+        framesSinceReset += frames;
+        return frames;
+    }
+
+    // Read the FIFO in the background while the CPU does something else, e.g. compresses the previous packet.
+    // submit(I2cTransaction &) hands the transaction to an I2cEngine (and wakes its bus task). The bus task reads the
+    // count, waits for minFrames frames (once, for as long as they take at the sample rate) and reads them in bursts.
+    // drain() returns 0 until that is done, then hands out the prefetched frames before it reads the FIFO again.
+    // A FIFO that might have overflowed is left to drain(). Returns false if a prefetch is still running or buffered.
+    template<class Submit>
+    bool prefetch(Submit submit, uint8_t devAddr, size_t minFrames, void *wireObj = nullptr) {
+        if (prefetching || buffered > 0) return false;
+        prefetchTarget = minFrames < maxFramesInFIFO() - 2 ? minFrames : maxFramesInFIFO() - 2;
+        prefetchFrames = 0;
+        prefetchTx.read(devAddr, FIFO_COUNT_REGISTER, countBytes, 2, wireObj);
+        prefetchTx.next = &prefetchNext;
+        prefetchTx.context = this;
+        prefetching = submit(prefetchTx);
+        return prefetching;
+    }
+
+    // The bus task still owns the buffers of a prefetch()
+    bool prefetchPending() const { return prefetching && prefetchTx.status() == I2C_PENDING; }
+
+    // Timestamps in microseconds for the frames the last drain() returned. Frame i after a FIFO reset was sampled
+    // at epoch + i * samplePeriod(), so the spacing comes from the sensor clock and never jitters. The epoch is
+    // taken from the first drain after a reset: its newest frame is assumed to be from nowMicros.
+    // After an overflow the newest frame is again assumed to be from nowMicros, the frames between it and the
+    // last one handed out before are counted as dropped and skipped in the index.
+    void frameTimes(uint64_t nowMicros, size_t frames, uint64_t *out) {
+        if (overflowed && haveEpoch) {
+            uint64_t newest = nowMicros > epochMicros ? (nowMicros - epochMicros + periodMicros / 2) / periodMicros : 0;
+            if (newest + 1 > framesSinceReset) {
+                uint64_t missing = newest + 1 - framesSinceReset;
+                stats.droppedFrames += (uint32_t)missing;
+                framesSinceReset += missing;
+            }
+        }
+        overflowed = false;
+        if (!haveEpoch) {
+            epochMicros = nowMicros - (framesSinceReset - 1) * periodMicros;
+            haveEpoch = true;
+        }
+        uint64_t first = framesSinceReset - frames;
+        for (size_t i = 0; i < frames; i++) out[i] = epochMicros + (first + i) * periodMicros;
+    }
+
+    // Split big endian frames of frameSize bytes into frameSize / 2 channel columns. Without temperature the words from
+    // the gyro on go one column further, columns[IMU_TEMP] is left alone
+    static void decodeFrames(const uint8_t *data, size_t frames, size_t frameSize, int16_t *const *columns, size_t offset,
+                             bool temperature = true) {
+        const size_t words = frameSize / 2;
+        for (size_t f = 0; f < frames; f++) {
+            const uint8_t *p = data + f * frameSize;
+            for (size_t w = 0; w < words; w++) {
+                size_t ch = temperature || w < IMU_TEMP ? w : w + 1;
+                columns[ch][offset + f] = (int16_t)((p[2 * w] << 8) | p[2 * w + 1]);
+            }
+        }
+    }
+
+    const FifoStats &statistics() const { return stats; }
+
+private:
+    size_t maxFramesInFIFO() const { return MPU6050_FIFO_SIZE / frameSize; }
+
+    // Bus side of prefetch(): count -> (wait) -> bursts of whole frames
+    static bool prefetchNext(I2cTransaction &t) {
+        FifoAcquisition *self = (FifoAcquisition *)t.context;
+        size_t total;
+        if (t.regAddr == FIFO_COUNT_REGISTER) {
+            uint16_t count = (uint16_t)((self->countBytes[0] << 8) | self->countBytes[1]);
+            if (count + self->frameSize > MPU6050_FIFO_SIZE) return false; // may have overflowed, drain() sorts it out
+            total = count / self->frameSize;
+            if (total < self->prefetchTarget && t.holdMicros == 0) {
+                // too early: read the count once more when the missing frames should be there, then take what there is
+                t.holdMicros = (uint32_t)(self->prefetchTarget - total) * self->periodMicros;
+                return true;
+            }
+            self->prefetchTotal = total;
+        } else {
+            self->prefetchFrames += t.length / self->frameSize;
+        }
+        total = self->prefetchTotal;
+        if (self->prefetchFrames >= total) return false;
+        size_t burst = FIFO_MAX_BURST / self->frameSize;
+        size_t n = total - self->prefetchFrames < burst ? total - self->prefetchFrames : burst;
+        t.read(t.devAddr, FIFO_DATA_REGISTER, self->frameBuffer + self->prefetchFrames * self->frameSize,
+               (uint8_t)(n * self->frameSize), t.wireObj);
+        return true;
+    }
+
+    void restartClock() {
+        framesSinceReset = 0;
+        haveEpoch = false;
+        overflowed = false;
+    }
+
+    Device &device;
+    uint32_t periodMicros;
+    uint8_t frameSize;
+    bool withTemperature;
+    FifoStats stats;
+    uint64_t framesSinceReset; // index of the next frame, counted from the last FIFO reset
+    uint64_t epochMicros;      // when frame 0 was sampled
+    bool haveEpoch;
+    bool overflowed;           // the last drain() found the FIFO overflowed
+    uint8_t frameBuffer[MPU6050_FIFO_SIZE];
+
+    // prefetch() state. The bus task owns the transaction, countBytes, prefetchTotal, prefetchFrames and frameBuffer
+    // while the transaction is pending
+    I2cTransaction prefetchTx;
+    bool prefetching;
+    size_t prefetchTarget;
+    size_t prefetchTotal;
+    size_t prefetchFrames;
+    size_t buffered;   // prefetched frames not handed out yet
+    size_t bufferedAt; // first of them in frameBuffer
+    uint8_t countBytes[2];
+};
+
+#endif // FIFO_ACQUISITION_H
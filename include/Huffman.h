@@ -0,0 +1,299 @@
+#ifndef HUFFMAN_H
+#define HUFFMAN_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <queue>
+#include <string>
+#include <vector>
+
+// Longest code the encoder is allowed to emit. With at most 7 bits pending in the bit writer,
+// a code of up to 15 bits always fits into a 32-bit accumulator, and a decoder can resolve
+// any code with a single lookup into a table of 2^HUFFMAN_MAX_CODE_LENGTH entries
+#ifndef HUFFMAN_MAX_CODE_LENGTH
+#define HUFFMAN_MAX_CODE_LENGTH 15
+#endif
+
+static_assert(HUFFMAN_MAX_CODE_LENGTH >= 8 && HUFFMAN_MAX_CODE_LENGTH <= 16,
+              "HUFFMAN_MAX_CODE_LENGTH must allow 256 symbols and fit into a uint16_t code");
+
+// One entry of the code table: the code is stored right-aligned in "bits", MSB is sent first
+struct HuffmanCode {
+    uint16_t bits;
+    uint8_t length; // 0 = character does not occur
+};
+
+// Fixed-size code table indexed by the (unsigned) character
+typedef std::array<HuffmanCode, 256> HuffmanTable;
+
+// Data structure for the nodes in the Huffman Tree
+class Node {
+public:
+    char ch;
+	int freq;
+	Node *left;
+    Node *right;
+	Node(char c, int f) { // Everything here has a time complexity of O(1)
+		ch = c;
+        freq = f;
+		left = nullptr;
+		right = nullptr;
+	}
+};
+
+// This class ensures that the queue is always sorted by frequency ascending
+class Compare {
+public:
+	bool operator() (Node* a, Node* b) {
+		return a->freq > b->freq; // Time complexity: O(1)
+	}
+};
+
+// Traverse the huffman tree in preorder and store the depth of every leaf node as the code length of its character
+// The function is recursive, however every node is traversed only once, therefore this scales linear with O(n)
+inline void preOrder(Node* root, std::array<int, 256> &lengths, int depth) {
+	if (root == nullptr) return;                            // Time complexity: O(1)
+
+    // Only leaf nodes can contain a valid character for the Huffman codes
+	if (root->left == nullptr && root->right==nullptr) {    // Time complexity: O(1)
+		lengths[(uint8_t)root->ch] = depth > 0 ? depth : 1; // a lone character still needs one bit
+		return;
+	}
+
+	preOrder(root->left, lengths, depth + 1);               // Recursive call
+	preOrder(root->right, lengths, depth + 1);              // Recursive call
+}
+
+// Function to delete every Node from memory after generating codes (Nodes are created in memory with "new", meaning we need to manually remove them)
+// This function has a time complexity of O(n), every Node is traversed once
+inline void freeTree(Node* root) {
+    if (!root) return;
+    freeTree(root->left);
+    freeTree(root->right);
+    delete root;
+}
+
+// Package-merge (Larmore & Hirschberg): optimal code lengths under the constraint that no code is longer than maxLength.
+// "freqs" has to be sorted ascending, lengths[i] belongs to freqs[i]. Requires freqs.size() <= 2^maxLength.
+// Instead of keeping the content of every package, only remember per level whether an item is a package.
+// Leaves and packages are both merged in ascending order, so the first k items of a level always contain
+// the cheapest leaves, which is all we need to count how often every leaf was selected.
+// Time complexity: O(n * maxLength)
+inline std::vector<uint8_t> packageMerge(const std::vector<int> &freqs, int maxLength) {
+    size_t n = freqs.size();
+    std::vector<uint8_t> lengths(n, 0);
+    if (n == 0) return lengths;
+    if (n == 1) {
+        lengths[0] = 1;
+        return lengths;
+    }
+
+    std::vector<std::vector<bool>> isPackage(maxLength);
+    std::vector<uint64_t> prev, curr;
+    prev.reserve(2 * n);
+    curr.reserve(2 * n);
+
+    for (int level = 0; level < maxLength; level++) {
+        size_t packages = prev.size() / 2; // pair up the items of the previous (deeper) level
+        size_t leaf = 0, pkg = 0;
+        curr.clear();
+        while (leaf < n || pkg < packages) {
+            uint64_t packageWeight = pkg < packages ? prev[2 * pkg] + prev[2 * pkg + 1] : UINT64_MAX;
+            if (leaf < n && (uint64_t)freqs[leaf] <= packageWeight) {
+                curr.push_back(freqs[leaf++]);
+                isPackage[level].push_back(false);
+            } else {
+                curr.push_back(packageWeight);
+                isPackage[level].push_back(true);
+                pkg++;
+            }
+        }
+        prev.swap(curr);
+    }
+
+    // Select the 2n-2 cheapest items of the top level and walk down, expanding the selected packages
+    size_t take = 2 * n - 2;
+    for (int level = maxLength - 1; level >= 0; level--) {
+        size_t leaves = 0;
+        for (size_t i = 0; i < take; i++) {
+            if (!isPackage[level][i]) leaves++;
+        }
+        for (size_t i = 0; i < leaves; i++) lengths[i]++;
+        take = 2 * (take - leaves);
+    }
+    return lengths;
+}
+
+// Assign canonical codes: shorter codes first, characters of the same length ordered by their unsigned value.
+// The receiver can rebuild the exact same table from nothing but the characters and their code lengths.
+inline HuffmanTable canonicalCodes(const std::array<int, 256> &lengths) {
+    HuffmanTable table{};
+    uint32_t code = 0;
+    for (int len = 1; len <= HUFFMAN_MAX_CODE_LENGTH; len++) {
+        for (int sym = 0; sym < 256; sym++) {
+            if (lengths[sym] != len) continue;
+            table[sym].bits = (uint16_t)code++;
+            table[sym].length = (uint8_t)len;
+        }
+        code <<= 1;
+    }
+    return table;
+}
+
+// Checks a code table received from the other side before canonicalCodes() is run on it: every character appears
+// once with a length of 1..HUFFMAN_MAX_CODE_LENGTH, and the lengths satisfy the Kraft inequality. An over-full set
+// would number its codes past 2^HUFFMAN_MAX_CODE_LENGTH.
+inline bool validCodeLengths(const std::vector<char> &chars, const std::vector<uint8_t> &lengths) {
+    if (chars.size() != lengths.size() || chars.size() > 256) return false;
+    std::array<bool, 256> seen{};
+    uint32_t kraft = 0;
+    for (size_t i = 0; i < chars.size(); i++) {
+        if (lengths[i] == 0 || lengths[i] > HUFFMAN_MAX_CODE_LENGTH) return false;
+        if (seen[(uint8_t)chars[i]]) return false;
+        seen[(uint8_t)chars[i]] = true;
+        kraft += 1u << (HUFFMAN_MAX_CODE_LENGTH - lengths[i]);
+    }
+    return kraft <= (1u << HUFFMAN_MAX_CODE_LENGTH);
+}
+
+// returns the code table for the input char set and frequency set, no code is longer than HUFFMAN_MAX_CODE_LENGTH
+inline HuffmanTable generateHuffmanCodes(const std::vector<char> &chars, const std::vector<int> &freq) {
+
+	size_t n = chars.size();                                // Time complexity: O(1)
+    std::array<int, 256> lengths{};
+    if (n == 0) return canonicalCodes(lengths);
+
+    // priority queue
+	std::priority_queue<Node*, std::vector<Node*>, Compare> pq;
+	for (size_t i=0; i<n; i++) {  // Time complexity: O(n log n)
+		Node* tmp = new Node(chars[i],freq[i]); // Time complexity: O(1)
+		pq.push(tmp); // Time complexity: O(log n)
+	}
+
+    // build Huffman tree
+	while (pq.size()>=2) { // Executes approximately n-1 times
+        // every iteration reduces pq by exactly one node (removes two, adds one)
+
+		Node* l = pq.top();                             // Time complexity: O(1)
+		pq.pop();                                       // Time complexity: O(1)
+
+		Node* r = pq.top();                             // Time complexity: O(1)
+		pq.pop();                                       // Time complexity: O(1)
+
+        // combine the lowest frequency nodes to a new node
+		Node* newNode = new Node('$',l->freq + r->freq); // $ = internal node | time complexity: O(1)
+		newNode->left = l;                              // Time complexity: O(1)
+		newNode->right = r;                             // Time complexity: O(1)
+
+		pq.push(newNode);                               // Time complexity: worst case O(log n)
+	}
+    // The total complexity of this loop is O(n log n), the inner body takes O(log n), iterated n-1 times.
+
+	Node* root = pq.top();                              // Time complexity: O(1)
+	preOrder(root, lengths, 0);                         // Time complexity: O(n)
+    freeTree(root);
+
+    // Skewed frequencies can produce codes that are too long for the bit writer, limit them with package-merge
+    int longest = *std::max_element(lengths.begin(), lengths.end());
+    if (longest > HUFFMAN_MAX_CODE_LENGTH) {
+        std::vector<size_t> order(n);
+        for (size_t i = 0; i < n; i++) order[i] = i;
+        std::stable_sort(order.begin(), order.end(), [&freq](size_t a, size_t b) { return freq[a] < freq[b]; });
+
+        std::vector<int> sortedFreqs(n);
+        for (size_t i = 0; i < n; i++) sortedFreqs[i] = freq[order[i]];
+
+        std::vector<uint8_t> limited = packageMerge(sortedFreqs, HUFFMAN_MAX_CODE_LENGTH);
+        for (size_t i = 0; i < n; i++) lengths[(uint8_t)chars[order[i]]] = limited[i];
+    }
+
+	return canonicalCodes(lengths);
+}
+
+// Takes an std::string and the code table and writes the huffman coded representation as packed bytes, MSB first.
+// The last byte is padded with zeros, bitCount receives the number of valid bits.
+// Every code fits into the 32-bit accumulator next to the at most 7 pending bits, so there is no slow path.
+inline std::vector<uint8_t> packHuffmanBits(const std::string &input, const HuffmanTable &codes, size_t &bitCount) {
+    std::vector<uint8_t> out;
+    out.reserve(input.size());
+
+    uint32_t acc = 0;
+    unsigned int pending = 0;
+    bitCount = 0;
+
+    for (char c : input) {
+        const HuffmanCode &code = codes[(uint8_t)c];
+        acc = (acc << code.length) | code.bits;
+        pending += code.length;
+        bitCount += code.length;
+        while (pending >= 8) {
+            pending -= 8;
+            out.push_back((uint8_t)(acc >> pending));
+        }
+    }
+    if (pending > 0) out.push_back((uint8_t)(acc << (8 - pending)));
+
+    return out;
+}
+
+// Table-driven decoder for the receiving side. Every code is resolved with a single lookup of the next
+// HUFFMAN_MAX_CODE_LENGTH bits, the table is built from the characters and their code lengths only.
+// A code table that fails validCodeLengths() leaves the decoder invalid, and decode() rejects every stream.
+class HuffmanDecoder {
+public:
+    HuffmanDecoder(const std::vector<char> &chars, const std::vector<uint8_t> &lengths)
+        : table(1u << HUFFMAN_MAX_CODE_LENGTH, Entry{0, 0}), ok(validCodeLengths(chars, lengths)) {
+        if (!ok) return;
+        std::array<int, 256> bySymbol{};
+        for (size_t i = 0; i < chars.size(); i++) bySymbol[(uint8_t)chars[i]] = lengths[i];
+        HuffmanTable codes = canonicalCodes(bySymbol);
+
+        for (int sym = 0; sym < 256; sym++) {
+            const HuffmanCode &code = codes[sym];
+            if (code.length == 0) continue;
+            uint32_t shift = HUFFMAN_MAX_CODE_LENGTH - code.length;
+            uint32_t first = (uint32_t)code.bits << shift;
+            uint32_t last = first + (1u << shift);
+            for (uint32_t i = first; i < last; i++) table[i] = Entry{(uint8_t)sym, code.length};
+        }
+    }
+
+    bool valid() const { return ok; }
+
+    // Decode bitCount bits from data. Returns false if the stream contains a bit pattern that is not a code.
+    bool decode(const uint8_t *data, size_t bitCount, std::string &out) const {
+        if (!ok) return false;
+        size_t byteCount = (bitCount + 7) / 8;
+        size_t next = 0;
+        uint64_t acc = 0;
+        unsigned int available = 0;
+        size_t consumed = 0;
+
+        while (consumed < bitCount) {
+            while (available <= 56) {
+                acc |= (uint64_t)(next < byteCount ? data[next] : 0) << (56 - available);
+                next++;
+                available += 8;
+            }
+            const Entry &e = table[acc >> (64 - HUFFMAN_MAX_CODE_LENGTH)];
+            if (e.length == 0 || consumed + e.length > bitCount) return false;
+            out.push_back((char)e.symbol);
+            acc <<= e.length;
+            available -= e.length;
+            consumed += e.length;
+        }
+        return true;
+    }
+
+private:
+    struct Entry {
+        uint8_t symbol;
+        uint8_t length;
+    };
+    std::vector<Entry> table;
+    bool ok;
+};
+
+#endif // HUFFMAN_H
@@ -0,0 +1,133 @@
+#ifndef I2C_ENGINE_H
+#define I2C_ENGINE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "SpscRing.h"
+
+enum I2cStatus : int8_t {
+    I2C_FAILED = -1,
+    I2C_PENDING = 0, // queued or running
+    I2C_DONE = 1,
+};
+
+/**
+ * One register transfer: length bytes from or to regAddr of the device at devAddr on the bus wireObj.
+ * The submitter owns the transaction and its data buffer until status() is no longer I2C_PENDING.
+ * next() runs on the bus side after every successful transfer and may turn the transaction into a follow-up
+ * transfer (e.g. a FIFO burst sized by the count that was just read), it returns true to run it. holdMicros
+ * delays the follow-up without tying up the bus: a count that is still too low can be read again later.
+ * done() runs on the bus side once the transaction finished, e.g. to notify the submitting task. By then the
+ * submitter may already reuse the transaction, done() should only rely on context.
+ */
+struct I2cTransaction {
+    uint8_t devAddr;
+    uint8_t regAddr;
+    uint8_t length;
+    bool write;
+    uint8_t *data;
+    void *wireObj;
+    uint32_t holdMicros;
+    bool (*next)(I2cTransaction &t);
+    void (*done)(I2cTransaction &t);
+    void *context;
+    std::atomic<int8_t> state;
+
+    I2cTransaction() : devAddr(0), regAddr(0), length(0), write(false), data(nullptr), wireObj(nullptr), holdMicros(0),
+                       next(nullptr), done(nullptr), context(nullptr), state(I2C_DONE) {}
+
+    I2cStatus status() const { return (I2cStatus)state.load(std::memory_order_acquire); }
+
+    void read(uint8_t device, uint8_t reg, uint8_t *buffer, uint8_t n, void *wire = nullptr) {
+        set(device, reg, buffer, n, false, wire);
+    }
+
+    void writeTo(uint8_t device, uint8_t reg, uint8_t *buffer, uint8_t n, void *wire = nullptr) {
+        set(device, reg, buffer, n, true, wire);
+    }
+
+private:
+    void set(uint8_t device, uint8_t reg, uint8_t *buffer, uint8_t n, bool isWrite, void *wire) {
+        devAddr = device;
+        regAddr = reg;
+        data = buffer;
+        length = n;
+        write = isWrite;
+        wireObj = wire;
+        holdMicros = 0;
+    }
+};
+
+struct I2cEngineStats {
+    uint32_t submitted;
+    uint32_t transfers; // bus transactions, follow-ups included
+    uint32_t failed;
+    uint32_t rejected;  // submit() found the queue full
+};
+
+/**
+ * Queue of I2C transactions executed away from the task that issues them. The submitting task queues transfers
+ * for any number of devices and buses and carries on, the bus side (a task of its own on the ESP32, the test itself
+ * on the host) runs them one after another with runAll() and reports completion through status() and done().
+ * "Bus" does the actual transfers: bool read(devAddr, regAddr, length, data, wireObj),
+ * bool write(devAddr, regAddr, length, data, wireObj) and void hold(micros) to sleep before a held transfer,
+ * I2Cdev and vTaskDelay on the ESP32, a fake bus on the host.
+ * Transactions run in order, a held follow-up keeps the ones behind it waiting.
+ * One submitting task and one bus task: the queue is an SpscRing.
+ */
+template<class Bus, size_t Capacity>
+class I2cEngine {
+public:
+    I2cEngine(Bus &bus) : bus(bus), stats() {}
+
+    // Submitter: queue t, returns false if the queue is full or t is still pending
+    bool submit(I2cTransaction &t) {
+        if (t.status() == I2C_PENDING) return false;
+        t.state.store(I2C_PENDING, std::memory_order_relaxed);
+        if (!queue.push(&t)) {
+            t.state.store(I2C_FAILED, std::memory_order_release);
+            stats.rejected++;
+            return false;
+        }
+        stats.submitted++;
+        return true;
+    }
+
+    // Transactions waiting to be run
+    size_t pending() const { return queue.size(); }
+
+    // Bus side: run the oldest transaction and its follow-ups. Returns false if there was nothing to run
+    bool runOne() {
+        I2cTransaction *t;
+        if (queue.popSpan(&t, 1) == 0) return false;
+        bool ok;
+        do {
+            if (t->holdMicros) bus.hold(t->holdMicros);
+            ok = t->write ? bus.write(t->devAddr, t->regAddr, t->length, t->data, t->wireObj)
+                          : bus.read(t->devAddr, t->regAddr, t->length, t->data, t->wireObj);
+            stats.transfers++;
+        } while (ok && t->next && t->next(*t));
+        if (!ok) stats.failed++;
+        void (*done)(I2cTransaction &) = t->done;
+        t->state.store(ok ? I2C_DONE : I2C_FAILED, std::memory_order_release);
+        if (done) done(*t); // the submitter may already reuse t, see I2cTransaction
+        return true;
+    }
+
+    // Bus side: run everything that is queued, returns the number of transactions run
+    size_t runAll() {
+        size_t n = 0;
+        while (runOne()) n++;
+        return n;
+    }
+
+    const I2cEngineStats &statistics() const { return stats; }
+
+private:
+    Bus &bus;
+    SpscRing<I2cTransaction *, Capacity> queue;
+    I2cEngineStats stats;
+};
+
+#endif // I2C_ENGINE_H
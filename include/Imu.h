@@ -0,0 +1,149 @@
+#ifndef IMU_H
+#define IMU_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Raw MPU6050 channels, in the order the sensor writes them into its data registers and FIFO
+enum ImuChannel : uint8_t {
+    IMU_AX,
+    IMU_AY,
+    IMU_AZ,
+    IMU_TEMP,
+    IMU_GX,
+    IMU_GY,
+    IMU_GZ,
+    IMU_CHANNELS
+};
+
+// int16 channels from auxiliary sensors the MPU6050 reads on its second bus (see AuxSensors.h), 0 without any.
+// They follow the ImuChannels in FIFO frames, samples and blocks. Set with a build flag, e.g. -DIMU_AUX_CHANNELS=3
+#ifndef IMU_AUX_CHANNELS
+#define IMU_AUX_CHANNELS 0
+#endif
+const size_t SAMPLE_CHANNELS = IMU_CHANNELS + IMU_AUX_CHANNELS;
+static_assert(SAMPLE_CHANNELS < 32, "channels are tracked in 32-bit masks");
+const uint32_t ALL_SAMPLE_CHANNELS = (1ul << SAMPLE_CHANNELS) - 1;
+
+// Counts per unit for the full-scale range settings 0..3 (MPU6050_ACCEL_FS_* / MPU6050_GYRO_FS_*)
+const float ACCEL_LSB_PER_G[4] = {16384.0f, 8192.0f, 4096.0f, 2048.0f};
+const float GYRO_LSB_PER_DPS[4] = {131.0f, 65.5f, 32.8f, 16.4f};
+
+const float STANDARD_GRAVITY = 9.80665f;
+const float DEG_TO_RAD_F = 0.017453292519943295f;
+
+// Conversions to the SI units the Adafruit driver reports (m/s^2, rad/s, degrees Celsius)
+inline float accelToMs2(int16_t raw, uint8_t range) {
+    return raw / ACCEL_LSB_PER_G[range & 3] * STANDARD_GRAVITY;
+}
+
+inline float gyroToRads(int16_t raw, uint8_t range) {
+    return raw / GYRO_LSB_PER_DPS[range & 3] * DEG_TO_RAD_F;
+}
+
+inline float tempToCelsius(int16_t raw) {
+    return raw / 340.0f + 36.53f;
+}
+
+// Sample period in microseconds for SMPLRT_DIV and DLPF_CFG: the gyro outputs at 8kHz with the DLPF off (0 or 7), 1kHz otherwise
+inline uint32_t samplePeriodMicros(uint8_t rateDivider, uint8_t dlpfMode) {
+    return (dlpfMode == 0 || dlpfMode == 7 ? 125u : 1000u) * (1u + rateDivider);
+}
+
+// Full-scale settings (MPU6050_ACCEL_FS_* / MPU6050_GYRO_FS_*) raw counts were taken with. Index into the tables above.
+struct SampleScale {
+    uint8_t accelRange;
+    uint8_t gyroRange;
+};
+
+// One sample in raw sensor counts (ImuChannel order, then the auxiliary channels) and the time it was taken in microseconds since boot.
+// 64 bits never wrap and stay exact, a packet stores them as a base plus 32-bit offsets (see SampleBlock)
+struct ImuSample {
+    uint64_t timestamp;
+    int16_t values[SAMPLE_CHANNELS];
+    uint32_t fresh; // bit (1 << channel) for every value taken with this sample, the others are stale (see ChannelRates)
+    uint8_t device;  // which sensor took it when there are several, see MultiImuSource
+    uint8_t profile; // id of the SensorProfile the sensor was configured with
+};
+
+/**
+ * Sample rate divisor per channel: channel ch is taken with every divisor(ch)-th sample only, the samples in between
+ * carry it as stale. Temperature changes over seconds, at 100Hz a divisor of 50 still takes it twice a second.
+ * Every source keeps a copy and asks take() which of the slow channels fell due with the samples it just read,
+ * those are read once and marked fresh on the newest of them. Packets carry the slow channels as columns of their own.
+ */
+class ChannelRates {
+public:
+    // Every channel with every sample
+    ChannelRates() : fast(ALL_SAMPLE_CHANNELS) {
+        for (size_t ch = 0; ch < SAMPLE_CHANNELS; ch++) divisors[ch] = 1;
+        restart();
+    }
+
+    // imuDivisors: one per ImuChannel, auxDivisor for every auxiliary channel. 0 counts as 1
+    ChannelRates(const uint16_t *imuDivisors, uint16_t auxDivisor) : fast(0) {
+        for (size_t ch = 0; ch < SAMPLE_CHANNELS; ch++) {
+            uint16_t d = ch < IMU_CHANNELS ? imuDivisors[ch] : auxDivisor;
+            divisors[ch] = d > 1 ? d : 1;
+            if (divisors[ch] == 1) fast |= 1ul << ch;
+        }
+        restart();
+    }
+
+    uint16_t divisor(size_t channel) const { return divisors[channel]; }
+    bool isFast(size_t channel) const { return (fast >> channel) & 1; }
+    // Channels taken with every sample and the decimated ones
+    uint32_t fastChannels() const { return fast; }
+    uint32_t slowChannels() const { return ALL_SAMPLE_CHANNELS & ~fast; }
+
+    // Every slow channel is due with the next sample, e.g. after a FIFO reset
+    void restart() {
+        for (size_t ch = 0; ch < SAMPLE_CHANNELS; ch++) countdown[ch] = 0;
+    }
+
+    // Advance the schedule by samples and return the slow channels that fell due among them
+    uint32_t take(size_t samples) {
+        uint32_t due = 0;
+        for (size_t ch = 0; ch < SAMPLE_CHANNELS; ch++) {
+            if (divisors[ch] == 1) continue;
+            if (countdown[ch] < samples) {
+                due |= 1ul << ch;
+                countdown[ch] = divisors[ch] - 1u; // counted from the newest sample, the one the value is attached to
+            } else {
+                countdown[ch] -= (uint32_t)samples;
+            }
+        }
+        return due;
+    }
+
+private:
+    uint16_t divisors[SAMPLE_CHANNELS];
+    uint32_t fast;
+    uint32_t countdown[SAMPLE_CHANNELS]; // samples until the channel is due again
+};
+
+/**
+ * Where samples come from. The application only sees raw counts, how they get off the sensor
+ * (register polling, FIFO, interrupts, a simulation on the host) is up to the implementation.
+ */
+class ImuSource {
+public:
+    virtual ~ImuSource() {}
+
+    // Configure the sensor for this way of reading it, returns false if that failed
+    virtual bool begin() = 0;
+
+    // Called when reading pauses, e.g. to compress the packet that was just read. A source may keep reading in the background
+    virtual void pause() {}
+
+    // Called before reading continues after a pause, e.g. while the previous packet was compressed
+    virtual void resume() {}
+
+    // Wait for samples and write up to maxSamples of them to out, returns how many were written
+    virtual size_t read(ImuSample *out, size_t maxSamples) = 0;
+
+    // Like read(), but without waiting: returns what is there right now, possibly nothing
+    virtual size_t poll(ImuSample *out, size_t maxSamples) { return read(out, maxSamples); }
+};
+
+#endif // IMU_H
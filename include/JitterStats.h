@@ -0,0 +1,93 @@
+#ifndef JITTER_STATS_H
+#define JITTER_STATS_H
+
+#include <cstddef>
+#include <cstdint>
+
+#define JITTER_BINS 16
+
+/**
+ * Histogram of the deviation of inter-sample intervals from the expected sample period.
+ * Bin JITTER_BINS / 2 holds intervals within +/- binWidth / 2 of the period, every bin further out
+ * is one binWidth late (right) or early (left). The outermost bins also collect everything beyond them.
+ * Timestamps are microseconds from a free running 32-bit counter, wrap-arounds are fine.
+ */
+class JitterHistogram {
+public:
+    JitterHistogram(uint32_t expectedPeriod, uint32_t binWidth) : period(expectedPeriod), width(binWidth ? binWidth : 1) {
+        reset();
+    }
+
+    void setPeriod(uint32_t expectedPeriod) {
+        period = expectedPeriod;
+        reset();
+    }
+
+    void reset() {
+        clear();
+        havePrevious = false;
+    }
+
+    // Start counting over, e.g. after the bins were reported. Unlike reset() the next interval still counts
+    void clear() {
+        for (size_t i = 0; i < JITTER_BINS; i++) bins[i] = 0;
+        intervals = 0;
+        minInterval = UINT32_MAX;
+        maxInterval = 0;
+        totalInterval = 0;
+    }
+
+    // Record the timestamp of a sample
+    void record(uint32_t timestamp) {
+        if (havePrevious) {
+            uint32_t interval = timestamp - previous;
+            int32_t deviation = (int32_t)(interval - period);
+
+            // floor((deviation + width / 2) / width), shifted so that 0 lands in the middle bin
+            int32_t shifted = deviation + (int32_t)(width / 2);
+            int32_t bin = (shifted >= 0 ? shifted / (int32_t)width : -((-shifted + (int32_t)width - 1) / (int32_t)width))
+                          + JITTER_BINS / 2;
+            if (bin < 0) bin = 0;
+            if (bin >= JITTER_BINS) bin = JITTER_BINS - 1;
+            bins[bin]++;
+
+            intervals++;
+            totalInterval += interval;
+            if (interval < minInterval) minInterval = interval;
+            if (interval > maxInterval) maxInterval = interval;
+        }
+        previous = timestamp;
+        havePrevious = true;
+    }
+
+    // Forget the previous timestamp, e.g. after a pause in sampling that should not count as jitter
+    void restart() { havePrevious = false; }
+
+    uint32_t bin(size_t i) const { return bins[i]; }
+    uint32_t count() const { return intervals; }
+    uint32_t minimum() const { return intervals ? minInterval : 0; }
+    uint32_t maximum() const { return maxInterval; }
+    uint32_t mean() const { return intervals ? (uint32_t)(totalInterval / intervals) : 0; }
+    uint32_t binWidth() const { return width; }
+
+    // Largest absolute deviation from the expected period seen so far
+    uint32_t peakDeviation() const {
+        if (!intervals) return 0;
+        uint32_t late = maxInterval > period ? maxInterval - period : 0;
+        uint32_t early = minInterval < period ? period - minInterval : 0;
+        return late > early ? late : early;
+    }
+
+private:
+    uint32_t period;
+    uint32_t width;
+    uint32_t bins[JITTER_BINS];
+    uint32_t intervals;
+    uint32_t minInterval;
+    uint32_t maxInterval;
+    uint64_t totalInterval;
+    uint32_t previous;
+    bool havePrevious;
+};
+
+#endif // JITTER_STATS_H
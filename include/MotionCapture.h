@@ -0,0 +1,256 @@
+#ifndef MOTION_CAPTURE_H
+#define MOTION_CAPTURE_H
+
+#include <cstddef>
+#include <cstdint>
+#include "Imu.h"
+
+// Why the CPU woke up from a light sleep
+enum WakeCause : uint8_t {
+    WAKE_MOTION,    // the motion interrupt of the sensor
+    WAKE_WATERMARK, // the FIFO reached its watermark. The MPU6050 has no FIFO level interrupt, but its clock fills the FIFO
+                    // at a known rate: a timer for watermark frames * sample period does the job
+};
+
+enum CaptureState : uint8_t {
+    CAPTURE_IDLE,  // asleep between wake-ups, the FIFO fills and the newest samples are kept as pre-trigger history
+    CAPTURE_BURST, // streaming packets with the radio on until nothing moved for a while
+};
+
+// What draws current, in increasing order
+enum PowerState : uint8_t {
+    POWER_SLEEP, // light sleep, the sensor keeps sampling into its FIFO
+    POWER_AWAKE, // CPU running, radio off
+    POWER_RADIO, // CPU running, WiFi connected or connecting
+    POWER_STATES
+};
+
+// Supply current in every PowerState, e.g. from the datasheet or a measurement
+struct EnergyModel {
+    float milliamps[POWER_STATES];
+};
+
+struct CaptureConfig {
+    uint32_t watermarkMicros; // longest sleep: the time the FIFO takes to fill up to the watermark
+    uint32_t quietMicros;     // a burst ends after this long without motion
+};
+
+struct CaptureStats {
+    uint64_t micros[POWER_STATES]; // time spent in every PowerState
+    uint32_t motionWakes;
+    uint32_t watermarkWakes;
+    uint32_t bursts;
+    uint32_t packets;
+};
+
+// Charge drawn in millicoulomb (mA * s) for the time in stats
+inline float captureCharge(const CaptureStats &stats, const EnergyModel &model) {
+    float charge = 0.0f;
+    for (size_t p = 0; p < POWER_STATES; p++) charge += model.milliamps[p] * (float)stats.micros[p] / 1e6f;
+    return charge;
+}
+
+/**
+ * The sensor, the radio and the light sleep as MotionCapture sees them: the ESP32 in main.cpp,
+ * SimulatedCapturePlatform on the host.
+ */
+class CapturePlatform {
+public:
+    virtual ~CapturePlatform() {}
+
+    // Microseconds since boot
+    virtual uint64_t now() = 0;
+
+    // Sleep until the sensor reports motion, at most maxMicros
+    virtual WakeCause sleep(uint32_t maxMicros) = 0;
+
+    // Read what the FIFO collected and keep the newest samples as pre-trigger history
+    virtual void keepPreTrigger() = 0;
+
+    // Switch the radio on (and connect) or off (after what is queued was sent)
+    virtual void radio(bool on) = 0;
+
+    // A burst begins: the pre-trigger history goes out first
+    virtual void startBurst() = 0;
+
+    // Acquire, compress and queue one packet. Returns true if the sensor reported motion while it was taken
+    virtual bool capturePacket() = 0;
+};
+
+/**
+ * Duty-cycled capture: the CPU sleeps while the sensor samples into its FIFO. A watermark wake-up only moves the
+ * newest samples into the pre-trigger history and goes back to sleep, the radio stays off. Motion starts a burst:
+ * radio on, the history and then packet after packet go out until quietMicros pass without motion, then the radio
+ * goes off and the CPU back to sleep. step() does one wake-up or one packet, loop() calls it over and over.
+ * Every PowerState change is accounted, statistics() and captureCharge() tell where the time and the energy went.
+ */
+class MotionCapture {
+public:
+    MotionCapture(const CaptureConfig &config)
+        : config(config), current(CAPTURE_IDLE), power(POWER_AWAKE), since(0), lastMotion(0), stats() {}
+
+    // New watermark or quiet time, e.g. after the sample rate changed. Takes effect with the next sleep
+    void configure(const CaptureConfig &newConfig) { config = newConfig; }
+
+    void begin(uint64_t nowMicros) {
+        current = CAPTURE_IDLE;
+        power = POWER_AWAKE;
+        since = nowMicros;
+    }
+
+    void step(CapturePlatform &platform) {
+        if (current == CAPTURE_IDLE) {
+            enter(POWER_SLEEP, platform.now());
+            WakeCause cause = platform.sleep(config.watermarkMicros);
+            enter(POWER_AWAKE, platform.now());
+            platform.keepPreTrigger();
+            if (cause == WAKE_WATERMARK) {
+                stats.watermarkWakes++;
+                return;
+            }
+            stats.motionWakes++;
+            stats.bursts++;
+            enter(POWER_RADIO, platform.now()); // connecting counts as radio time
+            platform.radio(true);
+            platform.startBurst();
+            current = CAPTURE_BURST;
+            lastMotion = platform.now();
+            return;
+        }
+
+        bool motion = platform.capturePacket();
+        stats.packets++;
+        uint64_t now = platform.now();
+        if (motion) {
+            lastMotion = now;
+        } else if (now - lastMotion >= config.quietMicros) {
+            platform.radio(false);
+            enter(POWER_AWAKE, platform.now());
+            current = CAPTURE_IDLE;
+        }
+    }
+
+    CaptureState state() const { return current; }
+    PowerState powerState() const { return power; }
+
+    // Account the time in the current PowerState up to nowMicros, e.g. before printing the statistics
+    void account(uint64_t nowMicros) { enter(power, nowMicros); }
+
+    const CaptureStats &statistics() const { return stats; }
+
+private:
+    void enter(PowerState next, uint64_t nowMicros) {
+        if (nowMicros > since) stats.micros[power] += nowMicros - since;
+        since = nowMicros;
+        power = next;
+    }
+
+    CaptureConfig config;
+    CaptureState current;
+    PowerState power;
+    uint64_t since; // when the current PowerState was entered or last accounted
+    uint64_t lastMotion;
+    CaptureStats stats;
+};
+
+/**
+ * The newest Capacity samples from before a trigger. push() overwrites the oldest one when full,
+ * consume() hands them out oldest first and empties the buffer.
+ */
+template<size_t Capacity>
+class PreTriggerBuffer {
+public:
+    PreTriggerBuffer() : head(0), count(0) {}
+
+    void push(const ImuSample &sample) {
+        samples[(head + count) % Capacity] = sample;
+        if (count < Capacity) count++;
+        else head = (head + 1) % Capacity;
+    }
+
+    size_t size() const { return count; }
+    void clear() { head = count = 0; }
+
+    template<class F>
+    void consume(F f) {
+        for (; count > 0; count--) {
+            f(samples[head]);
+            head = (head + 1) % Capacity;
+        }
+    }
+
+private:
+    ImuSample samples[Capacity];
+    size_t head;
+    size_t count;
+};
+
+/**
+ * Host stand-in for the sensor and the radio. Motion happens in the given intervals (sorted, microseconds), the motion
+ * interrupt fires as soon as the sleep reaches one. The clock only moves while the platform sleeps or works:
+ * a packet takes packetMicros, connecting the radio connectMicros.
+ */
+class SimulatedCapturePlatform : public CapturePlatform {
+public:
+    struct Interval {
+        uint64_t start;
+        uint64_t end;
+    };
+
+    SimulatedCapturePlatform(const Interval *motion, size_t count, uint32_t packetMicros, uint32_t connectMicros)
+        : preTriggerReads(0), burstStarts(0), packets(0), motion(motion), count(count), packetMicros(packetMicros),
+          connectMicros(connectMicros), clock(0), radioOn(false) {}
+
+    uint64_t now() override { return clock; }
+
+    WakeCause sleep(uint32_t maxMicros) override {
+        uint64_t wake = clock + maxMicros;
+        for (size_t i = 0; i < count; i++) {
+            if (motion[i].end <= clock) continue;
+            uint64_t start = motion[i].start > clock ? motion[i].start : clock;
+            if (start < wake) {
+                clock = start;
+                return WAKE_MOTION;
+            }
+            break;
+        }
+        clock = wake;
+        return WAKE_WATERMARK;
+    }
+
+    void keepPreTrigger() override { preTriggerReads++; }
+
+    void radio(bool on) override {
+        if (on && !radioOn) clock += connectMicros;
+        radioOn = on;
+    }
+
+    void startBurst() override { burstStarts++; }
+
+    bool capturePacket() override {
+        uint64_t start = clock;
+        clock += packetMicros;
+        packets++;
+        for (size_t i = 0; i < count; i++) {
+            if (motion[i].start < clock && motion[i].end > start) return true;
+        }
+        return false;
+    }
+
+    bool radioIsOn() const { return radioOn; }
+
+    // What the state machine asked for
+    uint32_t preTriggerReads;
+    uint32_t burstStarts;
+    uint32_t packets;
+
+private:
+    const Interval *motion;
+    size_t count;
+    uint32_t packetMicros;
+    uint32_t connectMicros;
+    uint64_t clock;
+    bool radioOn;
+};
+
+#endif // MOTION_CAPTURE_H
@@ -0,0 +1,63 @@
+#ifndef MULTI_IMU_H
+#define MULTI_IMU_H
+
+#include <cstddef>
+#include <cstdint>
+#include "Imu.h"
+
+/**
+ * Several sensors read as one ImuSource, e.g. two MPU6050s at 0x68 and 0x69 on one bus or on a bus each.
+ * read() polls the sources one after another and tags every sample with the index of its source, so the
+ * FIFO drains of the sensors interleave instead of one sensor waiting until the other one has a packet.
+ * The first source polled moves on by one every call: no sensor gets starved when maxSamples is small.
+ * idle() runs when none of them had anything, delay(1) on the ESP32.
+ */
+class MultiImuSource : public ImuSource {
+public:
+    MultiImuSource(ImuSource *const *sources, uint8_t count, void (*idle)())
+        : sources(sources), count(count), idle(idle), next(0) {}
+
+    bool begin() override {
+        bool ok = true;
+        for (uint8_t d = 0; d < count; d++) ok = sources[d]->begin() && ok;
+        return ok;
+    }
+
+    void pause() override {
+        for (uint8_t d = 0; d < count; d++) sources[d]->pause();
+    }
+
+    void resume() override {
+        for (uint8_t d = 0; d < count; d++) sources[d]->resume();
+    }
+
+    size_t read(ImuSample *out, size_t maxSamples) override {
+        for (;;) {
+            size_t n = poll(out, maxSamples);
+            if (n > 0 || maxSamples == 0) return n;
+            idle();
+        }
+    }
+
+    size_t poll(ImuSample *out, size_t maxSamples) override {
+        size_t total = 0;
+        for (uint8_t k = 0; k < count && total < maxSamples; k++) {
+            uint8_t d = (uint8_t)((next + k) % count);
+            size_t n = sources[d]->poll(out + total, maxSamples - total);
+            for (size_t i = 0; i < n; i++) out[total + i].device = d;
+            total += n;
+        }
+        next = (uint8_t)((next + 1) % count);
+        return total;
+    }
+
+    uint8_t devices() const { return count; }
+
+private:
+    ImuSource *const *sources;
+    uint8_t count;
+    void (*idle)();
+    uint8_t next; // source polled first by the next call
+};
+
+#endif // MULTI_IMU_H
@@ -0,0 +1,206 @@
+#ifndef PACKET_H
+#define PACKET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "Huffman.h"
+#include "Imu.h"
+
+// Binary packet as sent with Content-Type: application/octet-stream. All integers are little endian.
+//
+//  offset  size  field
+//  0       2     magic "WB"
+//  2       1     version (PACKET_VERSION)
+//  3       1     codec (PacketCodec)
+//  4       4     original size in bits (size of the uncompressed JSON representation)
+//  8       4     payload size in bits (only the Huffman codec leaves the last byte partially used)
+//  12      2     number of code table entries n (0 for every codec except Huffman)
+//  14      1     accelerometer full-scale range of the raw counts (SampleScale, ACCEL_LSB_PER_G in Imu.h)
+//  15      1     gyroscope full-scale range of the raw counts (GYRO_LSB_PER_DPS in Imu.h)
+//  16      8     time of the first sample in microseconds since boot, the samples carry offsets from it
+//  24      1     number of channel groups g in the payload, one per sensor (1..PACKET_MAX_GROUPS)
+//  25      1     number of decimated channels s (0..PACKET_MAX_SLOW_CHANNELS)
+//  26      1     id of the sensor profile the samples were taken with (SensorProfile.h)
+//  27      4     sample period of that profile in microseconds
+//  31      3s    decimated channels: channel (ImuChannel, then the auxiliary ones), sample rate divisor (16 bits).
+//                The readings leave them out, they follow as columns of [time offset, value] pairs (see ChannelRates)
+//  31+3s   2n    code table: character, code length. The canonical codes follow from these (see Huffman.h)
+//  ...     ...   payload, (payload bits + 7) / 8 bytes. With g > 1 it holds one group per sensor, every group
+//                encoded the way a single sensor's samples are
+#define PACKET_MAGIC_0              'W'
+#define PACKET_MAGIC_1              'B'
+#define PACKET_VERSION              6
+#define PACKET_HEADER_SIZE          31 // without the decimated channels and the code table
+#define PACKET_MAX_GROUPS           8
+#define PACKET_MAX_SLOW_CHANNELS    8
+
+enum PacketCodec : uint8_t {
+    PACKET_CODEC_NONE = 0,
+    PACKET_CODEC_HUFFMAN = 1,
+    PACKET_CODEC_RLE = 2,
+    PACKET_CODEC_DELTA = 3,
+};
+
+// A channel taken at a fraction of the sample rate
+struct SlowChannel {
+    uint8_t channel;
+    uint16_t divisor;
+};
+
+// What the receiver needs to turn the samples of a packet back into units and absolute time
+struct PacketMeta {
+    SampleScale scale;
+    uint64_t baseMicros;
+    uint8_t groups;
+    uint8_t profile;
+    uint32_t periodMicros;
+    uint8_t slowCount;
+    SlowChannel slow[PACKET_MAX_SLOW_CHANNELS];
+};
+
+inline void putU16(uint8_t *p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+inline void putU32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+inline void putU64(uint8_t *p, uint64_t v) {
+    putU32(p, (uint32_t)v);
+    putU32(p + 4, (uint32_t)(v >> 32));
+}
+
+inline uint16_t getU16(const uint8_t *p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+inline uint32_t getU32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+inline uint64_t getU64(const uint8_t *p) {
+    return getU32(p) | ((uint64_t)getU32(p + 4) << 32);
+}
+
+// Serialize a packet. "chars" and "lengths" form the code table and are only used by the Huffman codec.
+inline std::vector<uint8_t> buildPacket(PacketCodec codec, const PacketMeta &meta, uint32_t originalBits, uint32_t payloadBits,
+                                        const std::vector<char> &chars, const std::vector<uint8_t> &lengths,
+                                        const uint8_t *payload, size_t payloadSize) {
+    size_t entries = codec == PACKET_CODEC_HUFFMAN ? chars.size() : 0;
+    size_t slowCount = meta.slowCount < PACKET_MAX_SLOW_CHANNELS ? meta.slowCount : PACKET_MAX_SLOW_CHANNELS;
+    std::vector<uint8_t> packet(PACKET_HEADER_SIZE + 3 * slowCount + 2 * entries + payloadSize);
+    uint8_t *p = packet.data();
+
+    p[0] = PACKET_MAGIC_0;
+    p[1] = PACKET_MAGIC_1;
+    p[2] = PACKET_VERSION;
+    p[3] = codec;
+    putU32(p + 4, originalBits);
+    putU32(p + 8, payloadBits);
+    putU16(p + 12, (uint16_t)entries);
+    p[14] = meta.scale.accelRange;
+    p[15] = meta.scale.gyroRange;
+    putU64(p + 16, meta.baseMicros);
+    p[24] = meta.groups;
+    p[25] = (uint8_t)slowCount;
+    p[26] = meta.profile;
+    putU32(p + 27, meta.periodMicros);
+    p += PACKET_HEADER_SIZE;
+    for (size_t i = 0; i < slowCount; i++) {
+        p[0] = meta.slow[i].channel;
+        putU16(p + 1, meta.slow[i].divisor);
+        p += 3;
+    }
+
+    for (size_t i = 0; i < entries; i++) {
+        *p++ = (uint8_t)chars[i];
+        *p++ = lengths[i];
+    }
+    if (payloadSize > 0) memcpy(p, payload, payloadSize);
+    return packet;
+}
+
+// Packet for the codecs that produce a string (none, run-length, delta)
+inline std::vector<uint8_t> buildPacket(PacketCodec codec, const PacketMeta &meta, uint32_t originalBits, const std::string &data) {
+    return buildPacket(codec, meta, originalBits, (uint32_t)data.size() * 8, std::vector<char>(), std::vector<uint8_t>(),
+                       (const uint8_t *)data.data(), data.size());
+}
+
+// View into a received packet, points into the buffer that was parsed
+struct PacketView {
+    PacketCodec codec;
+    PacketMeta meta;
+    uint32_t originalBits;
+    uint32_t payloadBits;
+    std::vector<char> chars;
+    std::vector<uint8_t> lengths;
+    const uint8_t *payload;
+    size_t payloadSize;
+};
+
+// Receiver side: validate and split a packet. Returns false for anything that is not a complete packet.
+inline bool parsePacket(const uint8_t *data, size_t size, PacketView &view) {
+    if (size < PACKET_HEADER_SIZE) return false;
+    if (data[0] != PACKET_MAGIC_0 || data[1] != PACKET_MAGIC_1 || data[2] != PACKET_VERSION) return false;
+    if (data[3] > PACKET_CODEC_DELTA) return false;
+
+    view.codec = (PacketCodec)data[3];
+    view.originalBits = getU32(data + 4);
+    view.payloadBits = getU32(data + 8);
+    size_t entries = getU16(data + 12);
+    view.meta.scale.accelRange = data[14];
+    view.meta.scale.gyroRange = data[15];
+    view.meta.baseMicros = getU64(data + 16);
+    view.meta.groups = data[24];
+    view.meta.slowCount = data[25];
+    view.meta.profile = data[26];
+    view.meta.periodMicros = getU32(data + 27);
+    if (view.meta.scale.accelRange > 3 || view.meta.scale.gyroRange > 3) return false;
+    if (view.meta.groups == 0 || view.meta.groups > PACKET_MAX_GROUPS) return false;
+    if (view.meta.slowCount > PACKET_MAX_SLOW_CHANNELS) return false;
+    size_t table = PACKET_HEADER_SIZE + 3 * view.meta.slowCount;
+    size_t offset = table + 2 * entries;
+    if (entries > 256 || offset > size) return false;
+
+    for (size_t i = 0; i < view.meta.slowCount; i++) {
+        const uint8_t *p = data + PACKET_HEADER_SIZE + 3 * i;
+        view.meta.slow[i].channel = p[0];
+        view.meta.slow[i].divisor = getU16(p + 1);
+        if (view.meta.slow[i].divisor < 2) return false;
+    }
+    view.chars.clear();
+    view.lengths.clear();
+    for (size_t i = 0; i < entries; i++) {
+        view.chars.push_back((char)data[table + 2 * i]);
+        view.lengths.push_back(data[table + 2 * i + 1]);
+    }
+    // A code table the decoder cannot hold (over-full, zero lengths, repeated characters) is not a packet
+    if (!validCodeLengths(view.chars, view.lengths)) return false;
+
+    view.payload = data + offset;
+    view.payloadSize = size - offset;
+    return ((uint64_t)view.payloadBits + 7) / 8 == view.payloadSize;
+}
+
+// Receiver side: restore the transmitted string of a packet. Huffman payloads are decoded,
+// every other codec carries its string as plain bytes.
+inline bool decodePacketPayload(const PacketView &view, std::string &out) {
+    out.clear();
+    if (view.codec != PACKET_CODEC_HUFFMAN) {
+        out.assign((const char *)view.payload, view.payloadSize);
+        return true;
+    }
+    out.reserve(view.originalBits / 8);
+    HuffmanDecoder decoder(view.chars, view.lengths);
+    return decoder.decode(view.payload, view.payloadBits, out);
+}
+
+#endif // PACKET_H
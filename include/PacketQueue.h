@@ -0,0 +1,166 @@
+#ifndef PACKET_QUEUE_H
+#define PACKET_QUEUE_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+// A ready-to-send HTTP body
+struct OutgoingPacket {
+    const char *contentType;
+    std::vector<uint8_t> body;
+};
+
+// What happens when a packet is pushed into a full queue
+enum DropPolicy {
+    PACKET_DROP_OLDEST, // make room by discarding the packet that waited longest
+    PACKET_DROP_NEWEST, // discard the packet that was just pushed
+    PACKET_BLOCK,       // wait for the sender up to the push timeout, then discard the new packet
+};
+
+// Snapshot of the queue and sender counters
+struct SenderMetrics {
+    size_t depth;                // packets waiting right now
+    size_t highWater;            // largest depth seen so far
+    uint32_t enqueued;
+    uint32_t dropped;
+    uint32_t sent;
+    uint32_t failed;
+    uint32_t lastSendMicros;     // duration of the most recent send
+    uint32_t maxSendMicros;
+    uint64_t totalSendMicros;
+};
+
+// Anything that can transmit a packet, the HTTP sender on the device or a mock on the host
+class PacketSink {
+public:
+    virtual ~PacketSink() {}
+    virtual bool send(const OutgoingPacket &packet) = 0;
+};
+
+// Bounded queue of ready packets between the compression code and the sender task.
+// Builds on std::mutex / std::condition_variable, which map to FreeRTOS primitives on the ESP32.
+class PacketQueue {
+public:
+    PacketQueue(size_t capacity, DropPolicy policy) : capacity(capacity), policy(policy), metrics() {}
+
+    // Hand a packet to the sender. Returns false if a packet (this or an older one) had to be dropped.
+    bool push(OutgoingPacket &&packet, uint32_t timeoutMs = 0) {
+        std::unique_lock<std::mutex> lock(mutex);
+        bool droppedOne = false;
+
+        if (closed) {
+            metrics.dropped++;
+            return false;
+        }
+        if (queue.size() >= capacity) {
+            if (policy == PACKET_DROP_OLDEST && !queue.empty()) { // with capacity 0 there is nothing to make room from
+                queue.pop_front();
+                droppedOne = true;
+            } else if (policy == PACKET_BLOCK) {
+                notFull.wait_for(lock, std::chrono::milliseconds(timeoutMs),
+                                 [this] { return queue.size() < capacity || closed; });
+            }
+            if (queue.size() >= capacity || closed) {
+                metrics.dropped++;
+                return false;
+            }
+            if (droppedOne) metrics.dropped++;
+        }
+
+        queue.push_back(std::move(packet));
+        metrics.enqueued++;
+        if (queue.size() > metrics.highWater) metrics.highWater = queue.size();
+        notEmpty.notify_one();
+        return !droppedOne;
+    }
+
+    // Take the next packet, waits up to timeoutMs. Returns false on timeout or when the queue was closed and is empty.
+    bool pop(OutgoingPacket &packet, uint32_t timeoutMs) {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (!notEmpty.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this] { return !queue.empty() || closed; })) {
+            return false;
+        }
+        if (queue.empty()) return false;
+        packet = std::move(queue.front());
+        queue.pop_front();
+        notFull.notify_one();
+        return true;
+    }
+
+    // Record the outcome of one send, called by the sender
+    void recordSend(bool ok, uint32_t micros) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (ok) metrics.sent++;
+        else metrics.failed++;
+        metrics.lastSendMicros = micros;
+        if (micros > metrics.maxSendMicros) metrics.maxSendMicros = micros;
+        metrics.totalSendMicros += micros;
+    }
+
+    // Wake up everyone waiting, pop still drains what is left
+    void close() {
+        std::lock_guard<std::mutex> lock(mutex);
+        closed = true;
+        notEmpty.notify_all();
+        notFull.notify_all();
+    }
+
+    bool isClosed() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return closed;
+    }
+
+    SenderMetrics snapshot() {
+        std::lock_guard<std::mutex> lock(mutex);
+        SenderMetrics m = metrics;
+        m.depth = queue.size();
+        return m;
+    }
+
+private:
+    const size_t capacity;
+    const DropPolicy policy;
+    std::deque<OutgoingPacket> queue;
+    std::mutex mutex;
+    std::condition_variable notEmpty;
+    std::condition_variable notFull;
+    bool closed = false;
+    SenderMetrics metrics;
+};
+
+// Body of the sender task: take packets from the queue and pass them to the sink, timing every send
+class SenderWorker {
+public:
+    SenderWorker(PacketQueue &queue, PacketSink &sink) : queue(queue), sink(sink) {}
+
+    // Send at most one packet, returns false if none arrived within timeoutMs
+    bool runOnce(uint32_t timeoutMs) {
+        OutgoingPacket packet;
+        if (!queue.pop(packet, timeoutMs)) return false;
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        bool ok = sink.send(packet);
+        uint32_t micros = (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+                              std::chrono::steady_clock::now() - start).count();
+        queue.recordSend(ok, micros);
+        return true;
+    }
+
+    // Loop until the queue is closed and drained
+    void run() {
+        while (runOnce(1000) || !queue.isClosed()) {
+        }
+    }
+
+private:
+    PacketQueue &queue;
+    PacketSink &sink;
+};
+
+#endif // PACKET_QUEUE_H
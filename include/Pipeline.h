@@ -0,0 +1,87 @@
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include "SpscRing.h"
+
+// Timing of one pipeline stage. Busy time is spent working on an item, wait time blocked on the neighbouring stage.
+// The stage with the largest busy time per item limits the throughput of the whole pipeline.
+struct StageStats {
+    uint32_t items;
+    uint32_t lastBusyMicros;
+    uint64_t busyMicros;
+    uint64_t waitMicros;
+};
+
+inline uint64_t stageMicros(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to) {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(to - from).count();
+}
+
+// Account one item of a stage: it waited for input from waitStart to busyStart and worked on it until busyEnd
+inline void recordStage(StageStats &stats, std::chrono::steady_clock::time_point waitStart,
+                        std::chrono::steady_clock::time_point busyStart, std::chrono::steady_clock::time_point busyEnd) {
+    stats.waitMicros += stageMicros(waitStart, busyStart);
+    stats.lastBusyMicros = (uint32_t)stageMicros(busyStart, busyEnd);
+    stats.busyMicros += stats.lastBusyMicros;
+    stats.items++;
+}
+
+/**
+ * Wakes the consuming stage once the producing one has a packet's worth ready: notify() from the producer,
+ * wait(timeoutMs) in the consumer returns after a notify() (also one that came before) or the timeout.
+ * This is the host version on a condition variable, the ESP32 uses a FreeRTOS task notification with the same two methods.
+ */
+class ThreadSignal {
+public:
+    ThreadSignal() : pending(false) {}
+
+    void notify() {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending = true;
+        changed.notify_one();
+    }
+
+    void wait(uint32_t timeoutMs) {
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this] { return pending; });
+        pending = false;
+    }
+
+private:
+    bool pending;
+    std::mutex mutex;
+    std::condition_variable changed;
+};
+
+// One step of the sampling stage: acquire() pushes samples into the ring and never waits for the consumer, a full ring
+// drops them (SpscRing::overflowCount()). Wakes the consumer once packetSize samples are waiting
+template<class T, size_t Capacity, class Signal, class Acquire>
+void produceSamples(SpscRing<T, Capacity> &ring, Signal &consumer, StageStats &stats, size_t packetSize, Acquire acquire) {
+    std::chrono::steady_clock::time_point busyStart = std::chrono::steady_clock::now();
+    acquire(ring);
+    recordStage(stats, busyStart, busyStart, std::chrono::steady_clock::now());
+    if (ring.size() >= packetSize) consumer.notify();
+}
+
+// One step of the compressing stage: wait until packetSize samples are waiting, then process(ring) takes them out.
+// Returns false if they did not arrive within timeoutMs, the time waited still counts
+template<class T, size_t Capacity, class Signal, class Process>
+bool consumePacket(SpscRing<T, Capacity> &ring, Signal &signal, StageStats &stats, size_t packetSize, Process process,
+                   uint32_t timeoutMs) {
+    std::chrono::steady_clock::time_point waitStart = std::chrono::steady_clock::now();
+    if (ring.size() < packetSize) signal.wait(timeoutMs);
+    std::chrono::steady_clock::time_point busyStart = std::chrono::steady_clock::now();
+    if (ring.size() < packetSize) {
+        stats.waitMicros += stageMicros(waitStart, busyStart);
+        return false;
+    }
+    process(ring);
+    recordStage(stats, waitStart, busyStart, std::chrono::steady_clock::now());
+    return true;
+}
+
+#endif // PIPELINE_H
@@ -0,0 +1,183 @@
+#ifndef QUATERNION_CODEC_H
+#define QUATERNION_CODEC_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Channels of a DMP packet: the quaternion in Q30 (1 << 30 = 1.0) and the raw accel and gyro it was fused from
+enum DmpChannel : uint8_t {
+    DMP_QW,
+    DMP_QX,
+    DMP_QY,
+    DMP_QZ,
+    DMP_AX,
+    DMP_AY,
+    DMP_AZ,
+    DMP_GX,
+    DMP_GY,
+    DMP_GZ,
+    DMP_CHANNELS
+};
+
+// Largest DMP packet (MotionApps 4.1), sizes the burst buffer of DmpBlock::drain()
+#define DMP_MAX_PACKET_SIZE 48
+
+/**
+ * Fixed-capacity block of DMP samples, one int32 column per DmpChannel like SampleBlock.
+ * drain() fills it straight from the DMP FIFO. "Dmp" is one of the MotionApps classes on the ESP32,
+ * anything with dmpGetFIFOPacketSize(), dmpGetFIFOPackets() and the packet variants of
+ * dmpGetQuaternion / dmpGetAccel / dmpGetGyro works on the host.
+ */
+template<size_t Capacity>
+class DmpBlock {
+public:
+    DmpBlock() : count(0) {}
+
+    void clear() { count = 0; }
+    size_t size() const { return count; }
+    bool full() const { return count >= Capacity; }
+    static constexpr size_t capacity() { return Capacity; }
+
+    int32_t *column(size_t channel) { return data[channel]; }
+    const int32_t *column(size_t channel) const { return data[channel]; }
+
+    bool append(const int32_t *quat, const int16_t *accel, const int16_t *gyro) {
+        if (count >= Capacity) return false;
+        for (size_t i = 0; i < 4; i++) data[DMP_QW + i][count] = quat[i];
+        for (size_t i = 0; i < 3; i++) data[DMP_AX + i][count] = accel[i];
+        for (size_t i = 0; i < 3; i++) data[DMP_GX + i][count] = gyro[i];
+        count++;
+        return true;
+    }
+
+    // Take every packet waiting in the FIFO, as far as the block has room, in bursts of whole packets.
+    // Returns the number of packets added
+    template<class Dmp>
+    size_t drain(Dmp &dmp) {
+        const uint16_t packetSize = dmp.dmpGetFIFOPacketSize();
+        if (packetSize == 0 || packetSize > DMP_MAX_PACKET_SIZE) return 0;
+        const uint16_t perBurst = 255 / packetSize;
+        uint8_t burst[255];
+        size_t added = 0;
+        while (count < Capacity) {
+            size_t room = Capacity - count;
+            uint16_t wanted = room < perBurst ? (uint16_t)room : perBurst;
+            uint16_t n = dmp.dmpGetFIFOPackets(burst, wanted);
+            for (uint16_t k = 0; k < n; k++) {
+                const uint8_t *packet = burst + k * packetSize;
+                int32_t quat[4];
+                int16_t accel[3], gyro[3];
+                dmp.dmpGetQuaternion(quat, packet);
+                dmp.dmpGetAccel(accel, packet);
+                dmp.dmpGetGyro(gyro, packet);
+                append(quat, accel, gyro);
+            }
+            added += n;
+            if (n < wanted) break; // FIFO is empty
+        }
+        return added;
+    }
+
+private:
+    size_t count;
+    int32_t data[DMP_CHANNELS][Capacity];
+};
+
+inline uint32_t zigzagEncode(int32_t v) {
+    return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+}
+
+inline int32_t zigzagDecode(uint32_t v) {
+    return (int32_t)(v >> 1) ^ -(int32_t)(v & 1);
+}
+
+// Most samples one stream can carry, the count is stored in 16 bits
+#define DMP_STREAM_MAX_SAMPLES 65535
+
+// Worst case size of encodeDmpStream() for n samples: every column at 32 bits
+inline size_t dmpStreamMaxLength(size_t n) {
+    return 2 + DMP_CHANNELS * (1 + 4 * n);
+}
+
+// Lossless stream of n DMP samples:
+//
+//  offset  size  field
+//  0       2     sample count n (little endian)
+//  then for every DmpChannel in order:
+//          1     bit width w of the column (0..32)
+//          ...   n zigzag deltas of w bits each, LSB first, padded to a whole byte
+//
+// Deltas are taken modulo 2^32 from the previous sample (the first from 0), so any int32 survives the round trip.
+// The quaternion changes by a few hundred Q30 counts per DMP sample when moving slowly, which takes ~10 instead of 32 bits.
+// Returns the stream length, or 0 without writing anything if n exceeds DMP_STREAM_MAX_SAMPLES.
+inline size_t encodeDmpStream(const int32_t *const *columns, size_t n, uint8_t *out) {
+    if (n > DMP_STREAM_MAX_SAMPLES) return 0;
+    size_t pos = 0;
+    out[pos++] = (uint8_t)n;
+    out[pos++] = (uint8_t)(n >> 8);
+    for (size_t ch = 0; ch < DMP_CHANNELS; ch++) {
+        const int32_t *values = columns[ch];
+
+        uint32_t all = 0;
+        uint32_t previous = 0;
+        for (size_t i = 0; i < n; i++) {
+            all |= zigzagEncode((int32_t)((uint32_t)values[i] - previous));
+            previous = (uint32_t)values[i];
+        }
+        uint8_t width = 0;
+        while (width < 32 && (all >> width) != 0) width++;
+        out[pos++] = width;
+
+        uint64_t acc = 0;
+        unsigned pending = 0;
+        previous = 0;
+        for (size_t i = 0; i < n && width > 0; i++) {
+            acc |= (uint64_t)zigzagEncode((int32_t)((uint32_t)values[i] - previous)) << pending;
+            pending += width;
+            previous = (uint32_t)values[i];
+            while (pending >= 8) {
+                out[pos++] = (uint8_t)acc;
+                acc >>= 8;
+                pending -= 8;
+            }
+        }
+        if (pending > 0) out[pos++] = (uint8_t)acc;
+    }
+    return pos;
+}
+
+// Decode a stream into columns with room for at least maxSamples. Returns the number of samples, or -1 if the stream
+// is truncated, malformed or longer than maxSamples
+inline long decodeDmpStream(const uint8_t *data, size_t size, int32_t *const *columns, size_t maxSamples) {
+    if (size < 2) return -1;
+    size_t n = data[0] | (data[1] << 8);
+    if (n > maxSamples) return -1;
+    size_t pos = 2;
+    for (size_t ch = 0; ch < DMP_CHANNELS; ch++) {
+        if (pos >= size) return -1;
+        uint8_t width = data[pos++];
+        if (width > 32) return -1;
+        size_t bytes = (n * width + 7) / 8;
+        if (size - pos < bytes) return -1;
+
+        uint64_t acc = 0;
+        unsigned pending = 0;
+        uint32_t previous = 0;
+        uint64_t mask = width == 32 ? 0xFFFFFFFFull : ((1ull << width) - 1);
+        for (size_t i = 0; i < n; i++) {
+            while (pending < width) {
+                acc |= (uint64_t)data[pos++] << pending;
+                pending += 8;
+            }
+            uint32_t v = (uint32_t)(acc & mask);
+            acc >>= width;
+            pending -= width;
+            previous += (uint32_t)zigzagDecode(v);
+            columns[ch][i] = (int32_t)previous;
+        }
+        // the padding bits of the last byte were already consumed
+    }
+    return (long)n;
+}
+
+#endif // QUATERNION_CODEC_H
@@ -0,0 +1,69 @@
+#ifndef SAMPLE_BLOCK_H
+#define SAMPLE_BLOCK_H
+
+#include <cstddef>
+#include <cstdint>
+#include "Imu.h"
+
+/**
+ * Fixed-capacity packet of samples stored as a structure of arrays: one contiguous column per channel
+ * plus one for the timestamps. Codecs walk a column with unit stride straight out of the block,
+ * there is no transpose and nothing is allocated per packet.
+ * Timestamps are kept as the 64-bit time of the first sample plus a 32-bit offset per sample (microseconds),
+ * a packet would have to span more than 71 minutes for an offset to overflow.
+ * A column only takes the values that were fresh (ImuSample::fresh), so a decimated channel's column is shorter than
+ * the block. sampleIndex() tells which sample each of its values came with, and so when it was taken.
+ */
+template<size_t Capacity>
+class SampleBlock {
+    static_assert(Capacity <= 65536, "sample indices are 16 bits");
+
+public:
+    SampleBlock() : count(0), base(0), sizes() {}
+
+    void clear() {
+        count = 0;
+        for (size_t ch = 0; ch < SAMPLE_CHANNELS; ch++) sizes[ch] = 0;
+    }
+
+    // Add one sample at the end, returns false if the block is full
+    bool append(const ImuSample &sample) {
+        if (count >= Capacity) return false;
+        if (count == 0) base = sample.timestamp;
+        offsets[count] = (uint32_t)(sample.timestamp - base);
+        for (size_t ch = 0; ch < SAMPLE_CHANNELS; ch++) {
+            if (!((sample.fresh >> ch) & 1)) continue;
+            data[ch][sizes[ch]] = sample.values[ch];
+            indices[ch][sizes[ch]] = (uint16_t)count;
+            sizes[ch]++;
+        }
+        count++;
+        return true;
+    }
+
+    size_t size() const { return count; }
+    bool full() const { return count >= Capacity; }
+    static constexpr size_t capacity() { return Capacity; }
+
+    // Time of the first sample, microseconds since boot
+    uint64_t baseTime() const { return base; }
+    // Time of every sample relative to baseTime()
+    const uint32_t *timeOffsets() const { return offsets; }
+    uint64_t timestamp(size_t i) const { return base + offsets[i]; }
+
+    // Values of a channel, columnSize() of them: size() for a channel taken with every sample, fewer for a decimated one
+    const int16_t *column(size_t channel) const { return data[channel]; }
+    size_t columnSize(size_t channel) const { return sizes[channel]; }
+    // Sample the values of a column were taken with, timestamp(sampleIndex(channel)[j]) is when value j was taken
+    const uint16_t *sampleIndex(size_t channel) const { return indices[channel]; }
+
+private:
+    size_t count;
+    uint64_t base;
+    uint32_t offsets[Capacity];
+    size_t sizes[SAMPLE_CHANNELS];
+    int16_t data[SAMPLE_CHANNELS][Capacity];
+    uint16_t indices[SAMPLE_CHANNELS][Capacity];
+};
+
+#endif // SAMPLE_BLOCK_H
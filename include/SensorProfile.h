@@ -0,0 +1,54 @@
+#ifndef SENSOR_PROFILE_H
+#define SENSOR_PROFILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include "Imu.h"
+
+/**
+ * Named sensor configuration, e.g. "vibration 1 kHz" or "posture 50 Hz": sample rate, DLPF, full-scale ranges and
+ * what goes into the FIFO are set together. The id is recorded in every packet header, so the receiver knows the
+ * timing and the scale of every packet, also across a change at runtime.
+ * A lower DLPF bandwidth takes noise out of the low bits, which the lossless codecs then no longer have to carry.
+ */
+struct SensorProfile {
+    uint8_t id;
+    const char *name;
+    uint8_t rateDivider;         // SMPLRT_DIV: (8kHz or 1kHz) / (1 + rateDivider), see samplePeriodMicros()
+    uint8_t dlpfMode;            // MPU6050_DLPF_BW_*
+    SampleScale scale;           // MPU6050_ACCEL_FS_* / MPU6050_GYRO_FS_*
+    uint16_t temperatureDivisor; // FIFO contents: 1 puts the temperature into every frame, more reads it on its own (ChannelRates)
+};
+
+inline uint32_t profilePeriodMicros(const SensorProfile &profile) {
+    return samplePeriodMicros(profile.rateDivider, profile.dlpfMode);
+}
+
+// nullptr if there is no profile with that id
+inline const SensorProfile *findProfile(const SensorProfile *profiles, size_t count, uint8_t id) {
+    for (size_t i = 0; i < count; i++) {
+        if (profiles[i].id == id) return &profiles[i];
+    }
+    return nullptr;
+}
+
+// Channel rates of a profile: imuDivisors / auxDivisor as for ChannelRates, the temperature from the profile
+inline ChannelRates profileRates(const SensorProfile &profile, const uint16_t *imuDivisors, uint16_t auxDivisor) {
+    uint16_t divisors[IMU_CHANNELS];
+    for (size_t ch = 0; ch < IMU_CHANNELS; ch++) divisors[ch] = imuDivisors[ch];
+    divisors[IMU_TEMP] = profile.temperatureDivisor;
+    return ChannelRates(divisors, auxDivisor);
+}
+
+// Full-scale ranges, DLPF and sample rate of a profile. Inside a register batch (MPU6050_Base::beginRegisterBatch) they go out
+// with the FIFO setup of FifoAcquisition::begin() as a few burst writes, the rate and DLPF it writes again cost nothing extra.
+// "Device" is MPU6050_Base on the ESP32
+template<class Device>
+void applyProfile(Device &device, const SensorProfile &profile) {
+    device.setFullScaleAccelRange(profile.scale.accelRange);
+    device.setFullScaleGyroRange(profile.scale.gyroRange);
+    device.setDLPFMode(profile.dlpfMode);
+    device.setRate(profile.rateDivider);
+}
+
+#endif // SENSOR_PROFILE_H
@@ -0,0 +1,149 @@
+#ifndef SIMULATED_MPU6050_H
+#define SIMULATED_MPU6050_H
+
+#include <cstddef>
+#include <cstdint>
+#include "Imu.h"
+#include "MPU6050_FIFO.h"
+
+#define SIM_FIFO_COUNT_REGISTER 0x72 // MPU6050_RA_FIFO_COUNTH
+#define SIM_FIFO_DATA_REGISTER  0x74 // MPU6050_RA_FIFO_R_W
+
+/**
+ * Host stand-in for the MPU6050 FIFO. The sample clock pushes one frame per sample period while the FIFO is enabled,
+ * sample() does it by hand, hold() while an I2cEngine waits. Like the sensor, a full FIFO drops its oldest bytes
+ * (not whole frames) and sets FIFO_OFLOW until the interrupt status is read. Word w of frame n reads n * 16 + w, so a
+ * frame that is decoded off by some bytes shows.
+ * It has the FIFO methods of MPU6050_Base that FifoAcquisition uses, getFIFOPackets() is the library's own
+ * MPU6050_readFIFOPackets(). As an I2cEngine bus it answers reads of the FIFO count and data registers.
+ */
+class SimulatedMpu6050 {
+public:
+    SimulatedMpu6050()
+        : auxBytes(0), sampled(0), lostBytes(0), reads(0), head(0), count(0), overflowFlag(false), enabled(false),
+          accel(false), temperature(false), gyroX(false), gyroY(false), gyroZ(false), rateDivider(0), dlpfMode(0),
+          clockMicros(0), stats() {}
+
+    // --- configuration, as on MPU6050_Base ---
+    void setFIFOEnabled(bool on) { enabled = on; }
+    void setDLPFMode(uint8_t mode) { dlpfMode = mode; }
+    void setRate(uint8_t divider) { rateDivider = divider; }
+    void setAccelFIFOEnabled(bool on) { accel = on; }
+    void setTempFIFOEnabled(bool on) { temperature = on; }
+    void setXGyroFIFOEnabled(bool on) { gyroX = on; }
+    void setYGyroFIFOEnabled(bool on) { gyroY = on; }
+    void setZGyroFIFOEnabled(bool on) { gyroZ = on; }
+    void resetFIFO() {
+        head = count = 0;
+        overflowFlag = false;
+    }
+
+    // --- FIFO access, as on MPU6050_Base ---
+    uint16_t getFIFOCount() { return (uint16_t)count; }
+
+    // Reading the interrupt status clears the flag
+    bool getIntFIFOBufferOverflowStatus() {
+        bool was = overflowFlag;
+        overflowFlag = false;
+        return was;
+    }
+
+    // Like the sensor, an empty FIFO reads as zeros
+    void getFIFOBytes(uint8_t *data, uint8_t length) {
+        reads++;
+        for (uint8_t i = 0; i < length; i++) {
+            if (count == 0) {
+                data[i] = 0;
+                continue;
+            }
+            data[i] = bytes[head];
+            head = (head + 1) % MPU6050_FIFO_SIZE;
+            count--;
+        }
+    }
+
+    uint16_t getFIFOPackets(uint8_t *data, uint8_t length, uint16_t maxPackets, bool *overflowed = nullptr) {
+        return MPU6050_readFIFOPackets(*this, data, length, maxPackets, overflowed, stats);
+    }
+
+    const MPU6050_FIFOStats &getFIFOStats() const { return stats; }
+
+    // --- sensor side ---
+    size_t frameBytes() const {
+        return (accel ? 6 : 0) + (temperature ? 2 : 0) + (gyroX ? 2 : 0) + (gyroY ? 2 : 0) + (gyroZ ? 2 : 0) + auxBytes;
+    }
+
+    uint32_t samplePeriod() const { return samplePeriodMicros(rateDivider, dlpfMode); }
+
+    // Push the next frames as the sample clock would. Counts every frame sampled, also the ones the FIFO drops
+    void sample(size_t frames = 1) {
+        for (size_t f = 0; f < frames; f++) {
+            if (!enabled) continue;
+            size_t size = frameBytes();
+            for (size_t w = 0; w < size / 2; w++) {
+                uint16_t word = (uint16_t)(sampled * 16 + w);
+                push((uint8_t)(word >> 8));
+                push((uint8_t)word);
+            }
+            sampled++;
+        }
+    }
+
+    // Let time pass: one frame per sample period
+    void advance(uint32_t micros) {
+        clockMicros += micros;
+        uint32_t period = samplePeriod();
+        sample(clockMicros / period);
+        clockMicros %= period;
+    }
+
+    // What word w of frame n reads
+    static int16_t word(uint64_t n, size_t w) { return (int16_t)(uint16_t)(n * 16 + w); }
+
+    // --- I2cEngine bus ---
+    bool read(uint8_t, uint8_t regAddr, uint8_t length, uint8_t *data, void *) {
+        if (regAddr == SIM_FIFO_COUNT_REGISTER && length == 2) {
+            data[0] = (uint8_t)(count >> 8);
+            data[1] = (uint8_t)count;
+        } else if (regAddr == SIM_FIFO_DATA_REGISTER) {
+            getFIFOBytes(data, length);
+        } else {
+            for (uint8_t i = 0; i < length; i++) data[i] = 0;
+        }
+        return true;
+    }
+
+    bool write(uint8_t, uint8_t, uint8_t, uint8_t *, void *) { return true; }
+
+    void hold(uint32_t micros) { advance(micros); }
+
+    uint8_t auxBytes;   // bytes the auxiliary slaves add to every frame
+    uint64_t sampled;   // frames pushed since construction
+    uint64_t lostBytes; // dropped by a full FIFO
+    uint32_t reads;     // getFIFOBytes() calls, bursts through the bus included
+
+private:
+    void push(uint8_t b) {
+        if (count == MPU6050_FIFO_SIZE) { // the oldest byte makes room
+            head = (head + 1) % MPU6050_FIFO_SIZE;
+            count--;
+            lostBytes++;
+            overflowFlag = true;
+        }
+        bytes[(head + count) % MPU6050_FIFO_SIZE] = b;
+        count++;
+    }
+
+    uint8_t bytes[MPU6050_FIFO_SIZE];
+    size_t head;
+    size_t count;
+    bool overflowFlag;
+    bool enabled;
+    bool accel, temperature, gyroX, gyroY, gyroZ;
+    uint8_t rateDivider;
+    uint8_t dlpfMode;
+    uint32_t clockMicros; // time since the last frame
+    MPU6050_FIFOStats stats;
+};
+
+#endif // SIMULATED_MPU6050_H
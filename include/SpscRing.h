@@ -0,0 +1,99 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#ifndef SPSC_CACHE_LINE
+#define SPSC_CACHE_LINE 64
+#endif
+
+/**
+ * Lock-free single-producer / single-consumer ring with a fixed capacity (a power of two).
+ * push() never blocks or allocates, so the producer may be an ISR or a high priority sampler task.
+ * The consumer takes samples in bulk with popSpan(). Head and tail only ever grow and are masked on access,
+ * the producer and consumer indices sit on separate cache lines.
+ */
+template<class T, size_t Capacity>
+class SpscRing {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "SpscRing capacity must be a power of two");
+
+public:
+    SpscRing() : head(0), tail(0), highWater(0), overflows(0) {}
+
+    // Producer: append one item, returns false (and counts an overflow) if the ring is full
+    bool push(const T &item) {
+        size_t h = head.load(std::memory_order_relaxed);
+        size_t t = tail.load(std::memory_order_acquire);
+        if (h - t >= Capacity) {
+            overflows.store(overflows.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return false;
+        }
+        items[h & (Capacity - 1)] = item;
+        head.store(h + 1, std::memory_order_release);
+
+        size_t used = h + 1 - t;
+        if (used > highWater.load(std::memory_order_relaxed)) highWater.store(used, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Consumer: move up to max items into out (at most two contiguous copies), returns the number of items taken
+    size_t popSpan(T *out, size_t max) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        size_t h = head.load(std::memory_order_acquire);
+        size_t n = h - t;
+        if (n > max) n = max;
+
+        size_t start = t & (Capacity - 1);
+        size_t first = Capacity - start < n ? Capacity - start : n;
+        for (size_t i = 0; i < first; i++) out[i] = items[start + i];
+        for (size_t i = first; i < n; i++) out[i] = items[i - first];
+
+        tail.store(t + n, std::memory_order_release);
+        return n;
+    }
+
+    // Consumer: hand up to max items to visit(const T &) where they are, then free their slots. Returns the number of items visited
+    template<class Visit>
+    size_t consume(size_t max, Visit visit) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        size_t h = head.load(std::memory_order_acquire);
+        size_t n = h - t;
+        if (n > max) n = max;
+
+        for (size_t i = 0; i < n; i++) visit(items[(t + i) & (Capacity - 1)]);
+
+        tail.store(t + n, std::memory_order_release);
+        return n;
+    }
+
+    // Consumer: item i counted from the oldest one without taking it, nullptr if fewer are waiting
+    const T *peek(size_t i = 0) const {
+        size_t t = tail.load(std::memory_order_relaxed);
+        size_t h = head.load(std::memory_order_acquire);
+        return i < h - t ? &items[(t + i) & (Capacity - 1)] : nullptr;
+    }
+
+    // Number of items waiting, exact for the consumer, a lower bound for anyone else
+    size_t size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+    static constexpr size_t capacity() { return Capacity; }
+
+    // Largest fill level seen so far
+    size_t highWaterMark() const { return highWater.load(std::memory_order_relaxed); }
+
+    // Items rejected because the ring was full
+    uint32_t overflowCount() const { return overflows.load(std::memory_order_relaxed); }
+
+private:
+    alignas(SPSC_CACHE_LINE) std::atomic<size_t> head; // written by the producer only
+    alignas(SPSC_CACHE_LINE) std::atomic<size_t> tail; // written by the consumer only
+    alignas(SPSC_CACHE_LINE) std::atomic<size_t> highWater;
+    std::atomic<uint32_t> overflows;
+    alignas(SPSC_CACHE_LINE) T items[Capacity];
+};
+
+#endif // SPSC_RING_H
@@ -3,6 +3,8 @@
 // 2013-06-05 by Jeff Rowberg <jeff@rowberg.net>
 //
 // Changelog:
+//      2026-10-19 - guard the bus statistics with a critical section on the ESP32
+//      2026-10-19 - replace I2CDEV_SERIAL_DEBUG tracing with optional bus statistics (I2CDEV_STATS)
 //      2021-09-28 - allow custom Wire object as transaction function argument
 //      2020-01-20 - hardija : complete support for Teensy 3.x
 //      2015-10-30 - simondlevy : support i2c_t3 for Teensy3.1
@@ -48,6 +50,24 @@ THE SOFTWARE.
 
 #include "I2Cdev.h"
 
+#ifdef I2CDEV_STATS
+    #define I2CDEV_STATS_BEGIN()    uint32_t statsStart = I2CDEV_STATS_CLOCK()
+    #define I2CDEV_STATS_END(write, bytes, ok, timedOut) \
+        recordStats(devAddr, regAddr, write, bytes, ok, timedOut, I2CDEV_STATS_CLOCK() - statsStart)
+    // Transfers come from more than one task (and core on the ESP32), the table is shared
+    #if defined(ESP32)
+        static portMUX_TYPE statsMux = portMUX_INITIALIZER_UNLOCKED;
+        #define I2CDEV_STATS_LOCK()     portENTER_CRITICAL(&statsMux)
+        #define I2CDEV_STATS_UNLOCK()   portEXIT_CRITICAL(&statsMux)
+    #else
+        #define I2CDEV_STATS_LOCK()
+        #define I2CDEV_STATS_UNLOCK()
+    #endif
+#else
+    #define I2CDEV_STATS_BEGIN()
+    #define I2CDEV_STATS_END(write, bytes, ok, timedOut)
+#endif
+
 #if I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_SBWIRE
 
     #ifdef I2CDEV_IMPLEMENTATION_WARNINGS
@@ -207,16 +227,7 @@ int8_t I2Cdev::readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16
  * @return Number of bytes read (-1 indicates failure)
  */
 int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t timeout, void *wireObj) {
-    #ifdef I2CDEV_SERIAL_DEBUG
-        Serial.print("I2C (0x");
-        Serial.print(devAddr, HEX);
-        Serial.print(") reading ");
-        Serial.print(length, DEC);
-        Serial.print(" bytes from 0x");
-        Serial.print(regAddr, HEX);
-        Serial.print("...");
-    #endif
-
+    I2CDEV_STATS_BEGIN();
     uint8_t count = 0;
     uint32_t t1 = millis();
 
@@ -237,10 +248,6 @@ int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8
                 useWire->requestFrom((uint8_t)devAddr, (uint8_t)min((int)length - k, I2CDEVLIB_WIRE_BUFFER_LENGTH));
                 for (; useWire->available() && (timeout == 0 || millis() - t1 < timeout); count++) {
                     data[count] = useWire->receive();
-                    #ifdef I2CDEV_SERIAL_DEBUG
-                        Serial.print(data[count], HEX);
-                        if (count + 1 < length) Serial.print(" ");
-                    #endif
                 }
             }
         #elif (ARDUINO == 100)
@@ -257,10 +264,6 @@ int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8
                 useWire->requestFrom((uint8_t)devAddr, (uint8_t)min((int)length - k, I2CDEVLIB_WIRE_BUFFER_LENGTH));
                 for (; useWire->available() && (timeout == 0 || millis() - t1 < timeout); count++) {
                     data[count] = useWire->read();
-                    #ifdef I2CDEV_SERIAL_DEBUG
-                        Serial.print(data[count], HEX);
-                        if (count + 1 < length) Serial.print(" ");
-                    #endif
                 }
             }
         #elif (ARDUINO > 100)
@@ -277,10 +280,6 @@ int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8
                 useWire->requestFrom((uint8_t)devAddr, (uint8_t)min((int)length - k, I2CDEVLIB_WIRE_BUFFER_LENGTH));
                 for (; useWire->available() && (timeout == 0 || millis() - t1 < timeout); count++) {
                     data[count] = useWire->read();
-                    #ifdef I2CDEV_SERIAL_DEBUG
-                        Serial.print(data[count], HEX);
-                        if (count + 1 < length) Serial.print(" ");
-                    #endif
                 }
             }
         #endif
@@ -299,14 +298,10 @@ int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8
     #endif
 
     // check for timeout
-    if (timeout > 0 && millis() - t1 >= timeout && count < length) count = -1; // timeout
-
-    #ifdef I2CDEV_SERIAL_DEBUG
-        Serial.print(". Done (");
-        Serial.print(count, DEC);
-        Serial.println(" read).");
-    #endif
+    bool timedOut = timeout > 0 && millis() - t1 >= timeout && count < length;
+    if (timedOut) count = -1; // timeout
 
+    I2CDEV_STATS_END(false, length, count == length, timedOut);
     return count;
 }
 
@@ -319,16 +314,7 @@ int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8
  * @return Number of words read (-1 indicates failure)
  */
 int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, uint16_t timeout, void *wireObj) {
-    #ifdef I2CDEV_SERIAL_DEBUG
-        Serial.print("I2C (0x");
-        Serial.print(devAddr, HEX);
-        Serial.print(") reading ");
-        Serial.print(length, DEC);
-        Serial.print(" words from 0x");
-        Serial.print(regAddr, HEX);
-        Serial.print("...");
-    #endif
-
+    I2CDEV_STATS_BEGIN();
     uint8_t count = 0;
     uint32_t t1 = millis();
 
@@ -356,10 +342,6 @@ int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint1
                     } else {
                         // second byte is bits 7-0 (LSb=0)
                         data[count] |= useWire->receive();
-                        #ifdef I2CDEV_SERIAL_DEBUG
-                            Serial.print(data[count], HEX);
-                            if (count + 1 < length) Serial.print(" ");
-                        #endif
                         count++;
                     }
                     msb = !msb;
@@ -386,10 +368,6 @@ int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint1
                     } else {
                         // second byte is bits 7-0 (LSb=0)
                         data[count] |= useWire->read();
-                        #ifdef I2CDEV_SERIAL_DEBUG
-                            Serial.print(data[count], HEX);
-                            if (count + 1 < length) Serial.print(" ");
-                        #endif
                         count++;
                     }
                     msb = !msb;
@@ -416,10 +394,6 @@ int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint1
                     } else {
                         // second byte is bits 7-0 (LSb=0)
                         data[count] |= useWire->read();
-                        #ifdef I2CDEV_SERIAL_DEBUG
-                            Serial.print(data[count], HEX);
-                            if (count + 1 < length) Serial.print(" ");
-                        #endif
                         count++;
                     }
                     msb = !msb;
@@ -444,14 +418,10 @@ int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint1
 
     #endif
 
-    if (timeout > 0 && millis() - t1 >= timeout && count < length) count = -1; // timeout
+    bool timedOut = timeout > 0 && millis() - t1 >= timeout && count < length;
+    if (timedOut) count = -1; // timeout
 
-    #ifdef I2CDEV_SERIAL_DEBUG
-        Serial.print(". Done (");
-        Serial.print(count, DEC);
-        Serial.println(" read).");
-    #endif
-    
+    I2CDEV_STATS_END(false, length * 2, count == length, timedOut);
     return count;
 }
 
@@ -569,15 +539,7 @@ bool I2Cdev::writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data, void *wi
  * @return Status of operation (true = success)
  */
 bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t* data, void *wireObj) {
-    #ifdef I2CDEV_SERIAL_DEBUG
-        Serial.print("I2C (0x");
-        Serial.print(devAddr, HEX);
-        Serial.print(") writing ");
-        Serial.print(length, DEC);
-        Serial.print(" bytes to 0x");
-        Serial.print(regAddr, HEX);
-        Serial.print("...");
-    #endif
+    I2CDEV_STATS_BEGIN();
     uint8_t status = 0;
 
 #if I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_SBWIRE || I2CDEV_IMPLEMENTATION == I2CDEV_TEENSY_3X_WIRE
@@ -598,10 +560,6 @@ bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_
         Fastwire::write(regAddr);
     #endif
     for (uint8_t i = 0; i < length; i++) {
-        #ifdef I2CDEV_SERIAL_DEBUG
-            Serial.print(data[i], HEX);
-            if (i + 1 < length) Serial.print(" ");
-        #endif
         #if ((I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO < 100) || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_NBWIRE)
             useWire->send((uint8_t) data[i]);
         #elif ((I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO >= 100) \
@@ -622,9 +580,7 @@ bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_
         Fastwire::stop();
         //status = Fastwire::endTransmission();
     #endif
-    #ifdef I2CDEV_SERIAL_DEBUG
-        Serial.println(". Done.");
-    #endif
+    I2CDEV_STATS_END(true, length, status == 0, false);
     return status == 0;
 }
 
@@ -636,15 +592,7 @@ bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_
  * @return Status of operation (true = success)
  */
 bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t* data, void *wireObj) {
-    #ifdef I2CDEV_SERIAL_DEBUG
-        Serial.print("I2C (0x");
-        Serial.print(devAddr, HEX);
-        Serial.print(") writing ");
-        Serial.print(length, DEC);
-        Serial.print(" words to 0x");
-        Serial.print(regAddr, HEX);
-        Serial.print("...");
-    #endif
+    I2CDEV_STATS_BEGIN();
     uint8_t status = 0;
 
 #if I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_SBWIRE || I2CDEV_IMPLEMENTATION == I2CDEV_TEENSY_3X_WIRE
@@ -665,10 +613,6 @@ bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16
         Fastwire::write(regAddr);
     #endif
     for (uint8_t i = 0; i < length; i++) { 
-        #ifdef I2CDEV_SERIAL_DEBUG
-            Serial.print(data[i], HEX);
-            if (i + 1 < length) Serial.print(" ");
-        #endif
         #if ((I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO < 100) || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_NBWIRE)
             useWire->send((uint8_t)(data[i] >> 8));     // send MSB
             useWire->send((uint8_t)data[i]);          // send LSB
@@ -693,9 +637,7 @@ bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16
         Fastwire::stop();
         //status = Fastwire::endTransmission();
     #endif
-    #ifdef I2CDEV_SERIAL_DEBUG
-        Serial.println(". Done.");
-    #endif
+    I2CDEV_STATS_END(true, length * 2, status == 0, false);
     return status == 0;
 }
 
@@ -704,6 +646,111 @@ bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16
  */
 uint16_t I2Cdev::readTimeout = I2CDEV_DEFAULT_READ_TIMEOUT;
 
+#ifdef I2CDEV_STATS
+
+I2CdevStats I2Cdev::stats;
+
+/** Count one transfer against its devAddr/regAddr pair.
+ * Runs in a critical section on the ESP32: two tasks must not claim the
+ * same free entry. Elsewhere it is not synchronized.
+ */
+void I2Cdev::recordStats(uint8_t devAddr, uint8_t regAddr, bool write, uint16_t bytes, bool ok, bool timedOut, uint32_t cycles) {
+    I2CDEV_STATS_LOCK();
+    I2CdevRegisterStats *entry = 0;
+    for (uint8_t i = 0; i < stats.used; i++) {
+        if (stats.registers[i].devAddr == devAddr && stats.registers[i].regAddr == regAddr) {
+            entry = &stats.registers[i];
+            break;
+        }
+    }
+    if (!entry && stats.used < I2CDEV_STATS_SLOTS) {
+        entry = &stats.registers[stats.used++];
+        *entry = I2CdevRegisterStats();
+        entry->devAddr = devAddr;
+        entry->regAddr = regAddr;
+    }
+    if (!entry) {
+        stats.untracked++;
+    } else {
+        if (write) entry->writes++;
+        else entry->reads++;
+        entry->bytes += bytes;
+        if (timedOut) entry->timeouts++;
+        else if (!ok) entry->errors++;
+        entry->cycles += cycles;
+    }
+    I2CDEV_STATS_UNLOCK();
+}
+
+/** Copy the counters collected since the last resetStats().
+ * @param snapshot Where to copy them to
+ * @param reset Also clear them, no transfer gets lost in between
+ */
+void I2Cdev::getStats(I2CdevStats *snapshot, bool reset) {
+    I2CDEV_STATS_LOCK();
+    *snapshot = stats;
+    if (reset) {
+        stats.used = 0;
+        stats.untracked = 0;
+    }
+    I2CDEV_STATS_UNLOCK();
+}
+
+/** Clear all counters and forget the devAddr/regAddr pairs seen so far.
+ */
+void I2Cdev::resetStats() {
+    I2CDEV_STATS_LOCK();
+    stats.used = 0;
+    stats.untracked = 0;
+    I2CDEV_STATS_UNLOCK();
+}
+
+static void putStatsU32(uint8_t *out, uint32_t v) {
+    out[0] = (uint8_t)v;
+    out[1] = (uint8_t)(v >> 8);
+    out[2] = (uint8_t)(v >> 16);
+    out[3] = (uint8_t)(v >> 24);
+}
+
+/** Write the counters in the compact binary layout described in I2Cdev.h.
+ * Entries that do not fit into the buffer are left out, the entry count in
+ * the header says how many were written.
+ * @param buffer Destination
+ * @param size Size of the destination in bytes
+ * @return Number of bytes written (0 if not even the header fits)
+ */
+uint16_t I2Cdev::dumpStats(uint8_t *buffer, uint16_t size) {
+    if (size < I2CDEV_STATS_DUMP_HEADER) return 0;
+    I2CDEV_STATS_LOCK();
+    uint8_t n = stats.used;
+    uint16_t room = (size - I2CDEV_STATS_DUMP_HEADER) / I2CDEV_STATS_DUMP_ENTRY;
+    if (n > room) n = room;
+    uint16_t mhz = I2CDEV_STATS_CLOCK_MHZ();
+    buffer[0] = 'I';
+    buffer[1] = 'S';
+    buffer[2] = I2CDEV_STATS_DUMP_VERSION;
+    buffer[3] = n;
+    buffer[4] = (uint8_t)mhz;
+    buffer[5] = (uint8_t)(mhz >> 8);
+    putStatsU32(buffer + 6, stats.untracked);
+    uint8_t *p = buffer + I2CDEV_STATS_DUMP_HEADER;
+    for (uint8_t i = 0; i < n; i++, p += I2CDEV_STATS_DUMP_ENTRY) {
+        const I2CdevRegisterStats &e = stats.registers[i];
+        p[0] = e.devAddr;
+        p[1] = e.regAddr;
+        putStatsU32(p + 2, e.reads);
+        putStatsU32(p + 6, e.writes);
+        putStatsU32(p + 10, e.bytes);
+        putStatsU32(p + 14, e.errors);
+        putStatsU32(p + 18, e.timeouts);
+        putStatsU32(p + 22, e.cycles);
+    }
+    I2CDEV_STATS_UNLOCK();
+    return p - buffer;
+}
+
+#endif
+
 #if I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE
     // I2C library
     //////////////////////
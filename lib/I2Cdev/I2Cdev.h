@@ -3,6 +3,7 @@
 // 2013-06-05 by Jeff Rowberg <jeff@rowberg.net>
 //
 // Changelog:
+//      2026-10-19 - replace I2CDEV_SERIAL_DEBUG tracing with optional bus statistics (I2CDEV_STATS)
 //      2021-09-28 - allow custom Wire object as transaction function argument
 //      2020-01-20 - hardija : complete support for Teensy 3.x
 //      2015-10-30 - simondlevy : support i2c_t3 for Teensy3.1
@@ -80,9 +81,13 @@ THE SOFTWARE.
 #define I2CDEV_TEENSY_3X_WIRE       6 // Teensy 3.x support using i2c_t3 library
 
 // -----------------------------------------------------------------------------
-// Arduino-style "Serial.print" debug constant (uncomment to enable)
+// Bus statistics (uncomment or add -DI2CDEV_STATS to the build flags to enable)
+// Counts transactions, bytes, errors, timeouts and time on the bus for every
+// devAddr/regAddr pair, see I2Cdev::getStats(). Replaces the old per-byte
+// Serial.print tracing (I2CDEV_SERIAL_DEBUG), which stretched every transfer
+// to serial port speed.
 // -----------------------------------------------------------------------------
-//#define I2CDEV_SERIAL_DEBUG
+//#define I2CDEV_STATS
 
 #ifdef ARDUINO
     #if ARDUINO < 100
@@ -129,6 +134,48 @@ THE SOFTWARE.
 // 1000ms default read timeout (modify with "I2Cdev::readTimeout = [ms];")
 #define I2CDEV_DEFAULT_READ_TIMEOUT     1000
 
+#ifdef I2CDEV_STATS
+    // number of distinct devAddr/regAddr pairs that are tracked
+    #ifndef I2CDEV_STATS_SLOTS
+        #define I2CDEV_STATS_SLOTS      32
+    #endif
+    // free running tick counter and its ticks per microsecond: CPU cycles where
+    // there is a cycle counter, micros() elsewhere
+    #ifndef I2CDEV_STATS_CLOCK
+        #if defined(ESP32) || defined(ESP8266)
+            #define I2CDEV_STATS_CLOCK()        ESP.getCycleCount()
+            #define I2CDEV_STATS_CLOCK_MHZ()    ((uint16_t)ESP.getCpuFreqMHz())
+        #else
+            #define I2CDEV_STATS_CLOCK()        ((uint32_t)micros())
+            #define I2CDEV_STATS_CLOCK_MHZ()    1
+        #endif
+    #endif
+
+    // I2Cdev::dumpStats() layout, all integers little endian:
+    //  header: "IS", version, entry count, clock MHz (2), untracked (4)
+    //  entry:  devAddr, regAddr, reads, writes, bytes, errors, timeouts, cycles (4 each)
+    #define I2CDEV_STATS_DUMP_VERSION   1
+    #define I2CDEV_STATS_DUMP_HEADER    10
+    #define I2CDEV_STATS_DUMP_ENTRY     26
+
+    typedef struct {
+        uint8_t devAddr;
+        uint8_t regAddr;    // first register of the transfer
+        uint32_t reads;     // readBytes/readWords calls, all read* methods end up there
+        uint32_t writes;    // writeBytes/writeWords calls
+        uint32_t bytes;     // bytes requested, both directions
+        uint32_t errors;    // NACKed writes and short reads
+        uint32_t timeouts;  // reads that ran into the timeout and returned -1
+        uint32_t cycles;    // time spent in the transfers, in I2CDEV_STATS_CLOCK ticks
+    } I2CdevRegisterStats;
+
+    typedef struct {
+        uint8_t used;       // entries of registers[] in use
+        uint32_t untracked; // transfers not counted because registers[] was full
+        I2CdevRegisterStats registers[I2CDEV_STATS_SLOTS];
+    } I2CdevStats;
+#endif
+
 class I2Cdev {
     public:
         I2Cdev();
@@ -152,6 +199,16 @@ class I2Cdev {
         static bool writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, void *wireObj=0);
 
         static uint16_t readTimeout;
+
+#ifdef I2CDEV_STATS
+        static void getStats(I2CdevStats *snapshot, bool reset=false);
+        static void resetStats();
+        static uint16_t dumpStats(uint8_t *buffer, uint16_t size);
+
+    private:
+        static void recordStats(uint8_t devAddr, uint8_t regAddr, bool write, uint16_t bytes, bool ok, bool timedOut, uint32_t cycles);
+        static I2CdevStats stats;
+#endif
 };
 
 #if I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE
@@ -5,6 +5,13 @@
 //
 // Changelog:
 //  2021/09/27 - split implementations out of header files, finally
+//  2026/10/19 - add optional register shadow cache and batched configuration writes
+//  2026/10/19 - upload DMP memory in Wire-buffer sized chunks and verify with one CRC read-back pass
+//  2026/10/19 - add SetActiveOffsets to restore saved calibration offsets
+//  2026/10/19 - add getFIFOPackets to drain whole packets in bursts
+//  2026/10/19 - getFIFOPackets keeps the backlog on overflow and counts dropped packets
+//  2026/10/19 - USER_CTRL writes inside a register batch go out in program order
+//  2026/10/19 - move the getFIFOPackets algorithm to MPU6050_FIFO.h so it runs on the host
 //     ... - ongoing debug release
 
 // NOTE: THIS IS ONLY A PARIAL RELEASE. THIS DEVICE CLASS IS CURRENTLY UNDERGOING ACTIVE
@@ -40,6 +47,7 @@ THE SOFTWARE.
 
 #include "I2Cdev.h"
 #include "helper_3dmath.h"
+#include "MPU6050_FIFO.h"
 
 // supporting link:  http://forum.arduino.cc/index.php?&topic=143444.msg1079517#msg1079517
 // also: http://forum.arduino.cc/index.php?&topic=141571.msg1062899#msg1062899s
@@ -435,8 +443,19 @@ THE SOFTWARE.
 #define MPU6050_DMP_MEMORY_BANK_SIZE    256
 #define MPU6050_DMP_MEMORY_CHUNK_SIZE   16
 
+// Largest DMP memory transfer per I2C transaction, the register address takes one byte of the Wire buffer
+#ifndef MPU6050_DMP_UPLOAD_CHUNK_SIZE
+    #if I2CDEVLIB_WIRE_BUFFER_LENGTH > 256
+        #define MPU6050_DMP_UPLOAD_CHUNK_SIZE 255
+    #else
+        #define MPU6050_DMP_UPLOAD_CHUNK_SIZE (I2CDEVLIB_WIRE_BUFFER_LENGTH - 1)
+    #endif
+#endif
+
 #define MPU6050_FIFO_DEFAULT_TIMEOUT 11000
 
+#define MPU6050_REGISTER_CACHE_SIZE 0x80 // register addresses 0x00 .. 0x7F
+
 class MPU6050_Base {
     public:
         MPU6050_Base(uint8_t address=MPU6050_DEFAULT_ADDRESS, void *wireObj=0);
@@ -625,6 +644,7 @@ class MPU6050_Base {
         // ACCEL_*OUT_* registers
         void getMotion9(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int16_t* gy, int16_t* gz, int16_t* mx, int16_t* my, int16_t* mz);
         void getMotion6(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int16_t* gy, int16_t* gz);
+        void getMotion7(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int16_t* gy, int16_t* gz, int16_t* t);
         void getAcceleration(int16_t* x, int16_t* y, int16_t* z);
         int16_t getAccelerationX();
         int16_t getAccelerationY();
@@ -721,6 +741,9 @@ class MPU6050_Base {
 		int8_t GetCurrentFIFOPacket(uint8_t *data, uint8_t length);
         void setFIFOByte(uint8_t data);
         void getFIFOBytes(uint8_t *data, uint8_t length);
+        uint16_t getFIFOPackets(uint8_t *data, uint8_t length, uint16_t maxPackets, bool *overflowed=0);
+        const MPU6050_FIFOStats &getFIFOStats();
+        void resetFIFOStats();
         void setFIFOTimeout(uint32_t fifoTimeout);
         uint32_t getFIFOTimeout();
 
@@ -815,6 +838,7 @@ class MPU6050_Base {
         void readMemoryBlock(uint8_t *data, uint16_t dataSize, uint8_t bank=0, uint8_t address=0);
         bool writeMemoryBlock(const uint8_t *data, uint16_t dataSize, uint8_t bank=0, uint8_t address=0, bool verify=true, bool useProgMem=false);
         bool writeProgMemoryBlock(const uint8_t *data, uint16_t dataSize, uint8_t bank=0, uint8_t address=0, bool verify=true);
+        uint32_t getMemoryBlockCRC(uint16_t dataSize, uint8_t bank=0, uint8_t address=0);
 
         bool writeDMPConfigurationSet(const uint8_t *data, uint16_t dataSize, bool useProgMem=false);
         bool writeProgDMPConfigurationSet(const uint8_t *data, uint16_t dataSize);
@@ -833,15 +857,40 @@ class MPU6050_Base {
 		void PID(uint8_t ReadAddress, float kP,float kI, uint8_t Loops);  // Does the math
 		void PrintActiveOffsets(); // See the results of the Calibration
 		int16_t * GetActiveOffsets();
+		void SetActiveOffsets(const int16_t *Offsets); // Restore offsets saved from GetActiveOffsets
+
+        // Register shadow cache
+        void setRegisterCacheEnabled(bool enabled);
+        bool getRegisterCacheEnabled();
+        void invalidateRegisterCache();
+        bool loadRegisterCache();
+        void beginRegisterBatch();
+        bool commitRegisterBatch();
+        static bool isCacheableRegister(uint8_t regAddr);
 
     protected:
+        int8_t readRegisterBit(uint8_t regAddr, uint8_t bitNum, uint8_t *data);
+        int8_t readRegisterBits(uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data);
+        int8_t readRegisterByte(uint8_t regAddr, uint8_t *data);
+        bool writeRegisterBit(uint8_t regAddr, uint8_t bitNum, uint8_t data);
+        bool writeRegisterBits(uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data);
+        bool writeRegisterByte(uint8_t regAddr, uint8_t data);
+        bool flushRegisterBatch();
+
         uint8_t devAddr;
         void *wireObj;
         uint8_t buffer[14];
         uint32_t fifoTimeout = MPU6050_FIFO_DEFAULT_TIMEOUT;
+
+        bool registerCacheEnabled = false;
+        bool registerBatch = false;
+        uint8_t registerCache[MPU6050_REGISTER_CACHE_SIZE];
+        uint8_t registerValid[MPU6050_REGISTER_CACHE_SIZE / 8]; // one bit per register: cached value is current
+        uint8_t registerDirty[MPU6050_REGISTER_CACHE_SIZE / 8]; // one bit per register: changed in a batch, not written yet
     
     private:
         int16_t offsets[6];
+        MPU6050_FIFOStats fifoStats;
 };
 
 #ifndef I2CDEVLIB_MPU6050_TYPEDEF
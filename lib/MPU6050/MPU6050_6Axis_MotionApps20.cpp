@@ -582,19 +582,31 @@ uint8_t MPU6050_6Axis_MotionApps20::dmpProcessFIFOPacket(const unsigned char *dm
 }
 uint8_t MPU6050_6Axis_MotionApps20::dmpReadAndProcessFIFOPacket(uint8_t numPackets, uint8_t *processed) {
     uint8_t status;
-    uint8_t buf[dmpPacketSize];
-    for (uint8_t i = 0; i < numPackets; i++) {
-        // read packet from FIFO
-        getFIFOBytes(buf, dmpPacketSize);
-
-        // process packet
-        if ((status = dmpProcessFIFOPacket(buf)) > 0) return status;
-        
-        // increment external process count variable, if supplied
-        if (processed != 0) (*processed)++;
+    // read as many whole packets per burst as getFIFOBytes() takes
+    uint8_t perBurst = 255 / dmpPacketSize;
+    uint8_t buf[perBurst * dmpPacketSize];
+    for (uint8_t i = 0; i < numPackets;) {
+        uint8_t n = (numPackets - i < perBurst) ? numPackets - i : perBurst;
+        getFIFOBytes(buf, n * dmpPacketSize);
+
+        for (uint8_t k = 0; k < n; k++, i++) {
+            // process packet
+            if ((status = dmpProcessFIFOPacket(buf + k * dmpPacketSize)) > 0) return status;
+
+            // increment external process count variable, if supplied
+            if (processed != 0) (*processed)++;
+        }
     }
     return 0;
 }
+/** Read every queued DMP packet (up to maxPackets) in bursts, see MPU6050_Base::getFIFOPackets().
+ * Decode each one with the packet variants, e.g. dmpGetQuaternion(q, data + i * dmpGetFIFOPacketSize()).
+ * @param data Buffer for maxPackets * dmpGetFIFOPacketSize() bytes
+ * @return Number of packets read
+ */
+uint16_t MPU6050_6Axis_MotionApps20::dmpGetFIFOPackets(uint8_t *data, uint16_t maxPackets) {
+    return getFIFOPackets(data, dmpPacketSize, maxPackets);
+}
 
 // uint8_t MPU6050_6Axis_MotionApps20::dmpSetFIFOProcessedCallback(void (*func) (void));
 
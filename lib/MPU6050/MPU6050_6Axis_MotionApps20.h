@@ -130,6 +130,7 @@ class MPU6050_6Axis_MotionApps20 : public MPU6050_Base {
 
         uint8_t dmpProcessFIFOPacket(const unsigned char *dmpData);
         uint8_t dmpReadAndProcessFIFOPacket(uint8_t numPackets, uint8_t *processed=NULL);
+        uint16_t dmpGetFIFOPackets(uint8_t *data, uint16_t maxPackets); // every queued packet, in bursts
 
         uint8_t dmpSetFIFOProcessedCallback(void (*func) (void));
 
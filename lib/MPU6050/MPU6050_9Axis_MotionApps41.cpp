@@ -385,7 +385,7 @@ uint8_t MPU6050_9Axis_MotionApps41::dmpInitialize() {
     I2Cdev::readByte(devAddr, MPU6050_RA_USER_CTRL, buffer, I2Cdev::readTimeout, wireObj); // ?
     
     DEBUG_PRINTLN(F("Enabling interrupt latch, clear on any read, AUX bypass enabled"));
-    I2Cdev::writeByte(devAddr, MPU6050_RA_INT_PIN_CFG, 0x32, wireObj);
+    writeRegisterByte(MPU6050_RA_INT_PIN_CFG, 0x32);
 
     // enable MPU AUX I2C bypass mode
     //DEBUG_PRINTLN(F("Enabling AUX I2C bypass mode..."));
@@ -501,10 +501,10 @@ uint8_t MPU6050_9Axis_MotionApps41::dmpInitialize() {
             writeMemoryBlock(dmpUpdate + 3, dmpUpdate[2], dmpUpdate[0], dmpUpdate[1]);
 
             DEBUG_PRINTLN(F("Disabling all standby flags..."));
-            I2Cdev::writeByte(0x68, MPU6050_RA_PWR_MGMT_2, 0x00, wireObj);
+            writeRegisterByte(MPU6050_RA_PWR_MGMT_2, 0x00);
 
             DEBUG_PRINTLN(F("Setting accelerometer sensitivity to +/- 2g..."));
-            I2Cdev::writeByte(0x68, MPU6050_RA_ACCEL_CONFIG, 0x00, wireObj);
+            writeRegisterByte(MPU6050_RA_ACCEL_CONFIG, 0x00);
 
             DEBUG_PRINTLN(F("Setting motion detection threshold to 2..."));
             setMotionDetectionThreshold(2);
@@ -524,35 +524,35 @@ uint8_t MPU6050_9Axis_MotionApps41::dmpInitialize() {
 
             // setup AK8975 (0x0E) as Slave 0 in read mode
             DEBUG_PRINTLN(F("Setting up AK8975 read slave 0..."));
-            I2Cdev::writeByte(0x68, MPU6050_RA_I2C_SLV0_ADDR, 0x8E, wireObj);
-            I2Cdev::writeByte(0x68, MPU6050_RA_I2C_SLV0_REG,  0x01, wireObj);
-            I2Cdev::writeByte(0x68, MPU6050_RA_I2C_SLV0_CTRL, 0xDA, wireObj);
+            writeRegisterByte(MPU6050_RA_I2C_SLV0_ADDR, 0x8E);
+            writeRegisterByte(MPU6050_RA_I2C_SLV0_REG, 0x01);
+            writeRegisterByte(MPU6050_RA_I2C_SLV0_CTRL, 0xDA);
 
             // setup AK8975 (0x0E) as Slave 2 in write mode
             DEBUG_PRINTLN(F("Setting up AK8975 write slave 2..."));
-            I2Cdev::writeByte(0x68, MPU6050_RA_I2C_SLV2_ADDR, 0x0E, wireObj);
-            I2Cdev::writeByte(0x68, MPU6050_RA_I2C_SLV2_REG,  0x0A, wireObj);
-            I2Cdev::writeByte(0x68, MPU6050_RA_I2C_SLV2_CTRL, 0x81, wireObj);
-            I2Cdev::writeByte(0x68, MPU6050_RA_I2C_SLV2_DO,   0x01, wireObj);
+            writeRegisterByte(MPU6050_RA_I2C_SLV2_ADDR, 0x0E);
+            writeRegisterByte(MPU6050_RA_I2C_SLV2_REG, 0x0A);
+            writeRegisterByte(MPU6050_RA_I2C_SLV2_CTRL, 0x81);
+            writeRegisterByte(MPU6050_RA_I2C_SLV2_DO, 0x01);
 
             // setup I2C timing/delay control
             DEBUG_PRINTLN(F("Setting up slave access delay..."));
-            I2Cdev::writeByte(0x68, MPU6050_RA_I2C_SLV4_CTRL, 0x18, wireObj);
-            I2Cdev::writeByte(0x68, MPU6050_RA_I2C_MST_DELAY_CTRL, 0x05, wireObj);
+            writeRegisterByte(MPU6050_RA_I2C_SLV4_CTRL, 0x18);
+            writeRegisterByte(MPU6050_RA_I2C_MST_DELAY_CTRL, 0x05);
 
             // enable interrupts
             DEBUG_PRINTLN(F("Enabling default interrupt behavior/no bypass..."));
-            I2Cdev::writeByte(0x68, MPU6050_RA_INT_PIN_CFG, 0x00, wireObj);
+            writeRegisterByte(MPU6050_RA_INT_PIN_CFG, 0x00);
 
             // enable I2C master mode and reset DMP/FIFO
             DEBUG_PRINTLN(F("Enabling I2C master mode..."));
-            I2Cdev::writeByte(0x68, MPU6050_RA_USER_CTRL, 0x20, wireObj);
+            writeRegisterByte(MPU6050_RA_USER_CTRL, 0x20);
             DEBUG_PRINTLN(F("Resetting FIFO..."));
-            I2Cdev::writeByte(0x68, MPU6050_RA_USER_CTRL, 0x24, wireObj);
+            writeRegisterByte(MPU6050_RA_USER_CTRL, 0x24);
             DEBUG_PRINTLN(F("Rewriting I2C master mode enabled because...I don't know"));
-            I2Cdev::writeByte(0x68, MPU6050_RA_USER_CTRL, 0x20, wireObj);
+            writeRegisterByte(MPU6050_RA_USER_CTRL, 0x20);
             DEBUG_PRINTLN(F("Enabling and resetting DMP/FIFO..."));
-            I2Cdev::writeByte(0x68, MPU6050_RA_USER_CTRL, 0xE8, wireObj);
+            writeRegisterByte(MPU6050_RA_USER_CTRL, 0xE8);
 
             DEBUG_PRINTLN(F("Writing final memory update 5/19 (function unknown)..."));
             for (j = 0; j < 4 || j < dmpUpdate[2] + 3; j++, pos++) dmpUpdate[j] = pgm_read_byte(&dmpUpdates[pos]);
@@ -859,19 +859,31 @@ uint8_t MPU6050_9Axis_MotionApps41::dmpProcessFIFOPacket(const unsigned char *dm
 }
 uint8_t MPU6050_9Axis_MotionApps41::dmpReadAndProcessFIFOPacket(uint8_t numPackets, uint8_t *processed) {
     uint8_t status;
-    uint8_t buf[dmpPacketSize];
-    for (uint8_t i = 0; i < numPackets; i++) {
-        // read packet from FIFO
-        getFIFOBytes(buf, dmpPacketSize);
-
-        // process packet
-        if ((status = dmpProcessFIFOPacket(buf)) > 0) return status;
-        
-        // increment external process count variable, if supplied
-        if (processed != 0) (*processed)++;
+    // read as many whole packets per burst as getFIFOBytes() takes
+    uint8_t perBurst = 255 / dmpPacketSize;
+    uint8_t buf[perBurst * dmpPacketSize];
+    for (uint8_t i = 0; i < numPackets;) {
+        uint8_t n = (numPackets - i < perBurst) ? numPackets - i : perBurst;
+        getFIFOBytes(buf, n * dmpPacketSize);
+
+        for (uint8_t k = 0; k < n; k++, i++) {
+            // process packet
+            if ((status = dmpProcessFIFOPacket(buf + k * dmpPacketSize)) > 0) return status;
+
+            // increment external process count variable, if supplied
+            if (processed != 0) (*processed)++;
+        }
     }
     return 0;
 }
+/** Read every queued DMP packet (up to maxPackets) in bursts, see MPU6050_Base::getFIFOPackets().
+ * Decode each one with the packet variants, e.g. dmpGetQuaternion(q, data + i * dmpGetFIFOPacketSize()).
+ * @param data Buffer for maxPackets * dmpGetFIFOPacketSize() bytes
+ * @return Number of packets read
+ */
+uint16_t MPU6050_9Axis_MotionApps41::dmpGetFIFOPackets(uint8_t *data, uint16_t maxPackets) {
+    return getFIFOPackets(data, dmpPacketSize, maxPackets);
+}
 
 // uint8_t MPU6050_9Axis_MotionApps41::dmpSetFIFOProcessedCallback(void (*func) (void));
 
@@ -131,6 +131,7 @@ class MPU6050_9Axis_MotionApps41 : public MPU6050_Base {
 
         uint8_t dmpProcessFIFOPacket(const unsigned char *dmpData);
         uint8_t dmpReadAndProcessFIFOPacket(uint8_t numPackets, uint8_t *processed=NULL);
+        uint16_t dmpGetFIFOPackets(uint8_t *data, uint16_t maxPackets); // every queued packet, in bursts
 
         uint8_t dmpSetFIFOProcessedCallback(void (*func) (void));
 
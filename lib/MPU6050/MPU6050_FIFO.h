@@ -0,0 +1,86 @@
+// I2Cdev library collection - MPU6050 FIFO packet reader
+// Portable part of MPU6050_Base::getFIFOPackets(). It only needs the FIFO count, the overflow status
+// and FIFO reads of its device, so it also runs against a simulated FIFO on a host without Arduino.
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - split out of MPU6050_Base::getFIFOPackets to run it against a simulated FIFO
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _MPU6050_FIFO_H_
+#define _MPU6050_FIFO_H_
+
+#include <stdint.h>
+
+#ifndef MPU6050_FIFO_SIZE
+#define MPU6050_FIFO_SIZE       1024
+#endif
+
+// Counters kept by MPU6050_Base::getFIFOPackets()
+struct MPU6050_FIFOStats {
+    uint32_t bursts = 0;         // getFIFOBytes() reads
+    uint32_t packets = 0;        // whole packets returned
+    uint32_t overflows = 0;      // times the FIFO was found overflowed
+    uint32_t droppedPackets = 0; // partial packets discarded at the head to get back in step
+};
+
+/** Read every complete packet waiting in the FIFO of device, see MPU6050_Base::getFIFOPackets().
+ * "Device" needs uint16_t getFIFOCount(), bool getIntFIFOBufferOverflowStatus() and
+ * void getFIFOBytes(uint8_t *data, uint8_t length): MPU6050_Base itself, or a simulated FIFO.
+ * @param stats Counters to update
+ * @return Number of packets read
+ */
+template<class Device>
+uint16_t MPU6050_readFIFOPackets(Device &device, uint8_t *data, uint8_t length, uint16_t maxPackets, bool *overflowed,
+                                 MPU6050_FIFOStats &stats) {
+    if (overflowed) *overflowed = false;
+    if (length == 0) return 0;
+    uint16_t fifoC = device.getFIFOCount();
+    if (fifoC + length > MPU6050_FIFO_SIZE && (fifoC >= MPU6050_FIFO_SIZE || device.getIntFIFOBufferOverflowStatus())) {
+        stats.overflows++;
+        if (overflowed) *overflowed = true;
+        uint8_t partial = fifoC % length;
+        if (partial) {
+            uint8_t trash[255];
+            device.getFIFOBytes(trash, partial);
+            stats.droppedPackets++;
+            fifoC -= partial;
+        }
+    }
+    uint16_t packets = fifoC / length;
+    if (packets > maxPackets) packets = maxPackets;
+    uint16_t perBurst = 255 / length;
+    for (uint16_t done = 0; done < packets;) {
+        uint16_t n = (packets - done < perBurst) ? packets - done : perBurst;
+        device.getFIFOBytes(data + done * length, (uint8_t)(n * length));
+        stats.bursts++;
+        done += n;
+    }
+    stats.packets += packets;
+    return packets;
+}
+
+#endif /* _MPU6050_FIFO_H_ */
@@ -4,6 +4,7 @@
 //
 // Changelog:
 //     2012-06-05 - add 3D math helper file to DMP6 example sketch
+//     2026-10-19 - add batched Q30 fixed-point quaternion kernels for whole DMP blocks
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -32,6 +33,9 @@ THE SOFTWARE.
 #ifndef _HELPER_3DMATH_H_
 #define _HELPER_3DMATH_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
 class Quaternion {
     public:
         float w;
@@ -213,4 +217,96 @@ class VectorFloat {
         }
 };
 
-#endif /* _HELPER_3DMATH_H_ */
\ No newline at end of file
+// ============================================================================
+// Batched Q30 fixed-point kernels
+// ============================================================================
+// The DMP delivers its quaternion as four int32 values in Q30 (1.0 = 1 << 30),
+// see dmpGetQuaternion(int32_t *, ...). The kernels below work on a whole
+// block of samples kept as one column per component (structure of arrays,
+// e.g. the DMP_QW..DMP_GZ columns of DmpBlock), in integer arithmetic only:
+// no sqrt, no division, no float per sample. Products are formed in 64 bits.
+// Accelerations are int32 columns in raw DMP counts, oneG is what +1g reads
+// (8192 for MotionApps20, 16384 for MotionApps612, see dmpGetLinearAccel()).
+// Arrays may be the same as the input columns to work in place.
+
+#define Q30_ONE         ((int32_t)1 << 30)
+
+// a * b for two Q30 numbers (or a Q30 number and an integer), rounded
+inline int32_t q30Multiply(int32_t a, int32_t b) {
+    return (int32_t)(((int64_t)a*b + ((int64_t)1 << 29)) >> 30);
+}
+
+// Scale every quaternion back to unit length. The DMP output drifts only
+// slightly away from 1, so 1/sqrt(|q|^2) is found with Newton steps from 1.0
+// instead of sqrt and a division: one or two for DMP output, up to six for
+// |q|^2 between 0.25 and 2. Quaternions further off than that are left alone.
+inline void q30Normalize(int32_t *qw, int32_t *qx, int32_t *qy, int32_t *qz, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        int64_t s = ((int64_t)qw[i]*qw[i] + (int64_t)qx[i]*qx[i] + (int64_t)qy[i]*qy[i] + (int64_t)qz[i]*qz[i]) >> 30;
+        if (s < Q30_ONE/4 || s > 2*(int64_t)Q30_ONE) continue;
+
+        // r = r * (3 - s * r^2) / 2 until s * r^2 is 1.0 within a few LSB
+        int64_t r = Q30_ONE;
+        for (uint8_t step = 0; step < 8; step++) {
+            int64_t sr2 = (s*((r*r) >> 30)) >> 30;
+            if (sr2 - Q30_ONE <= 4 && Q30_ONE - sr2 <= 4) break;
+            r = (r*(3*(int64_t)Q30_ONE - sr2)) >> 31;
+        }
+
+        qw[i] = q30Multiply(qw[i], (int32_t)r);
+        qx[i] = q30Multiply(qx[i], (int32_t)r);
+        qy[i] = q30Multiply(qy[i], (int32_t)r);
+        qz[i] = q30Multiply(qz[i], (int32_t)r);
+    }
+}
+
+// Gravity direction in Q30 for every quaternion, same as dmpGetGravity(VectorFloat *, Quaternion *)
+inline void q30Gravity(const int32_t *qw, const int32_t *qx, const int32_t *qy, const int32_t *qz, size_t n,
+                       int32_t *gx, int32_t *gy, int32_t *gz) {
+    for (size_t i = 0; i < n; i++) {
+        int64_t w = qw[i], x = qx[i], y = qy[i], z = qz[i];
+        gx[i] = (int32_t)((x*z - w*y + ((int64_t)1 << 28)) >> 29);
+        gy[i] = (int32_t)((w*x + y*z + ((int64_t)1 << 28)) >> 29);
+        gz[i] = (int32_t)((w*w - x*x - y*y + z*z + ((int64_t)1 << 29)) >> 30);
+    }
+}
+
+// Take gravity out of the raw accelerations: linear acceleration in the sensor
+// frame, same as dmpGetGravity() followed by dmpGetLinearAccel()
+inline void q30RemoveGravity(const int32_t *qw, const int32_t *qx, const int32_t *qy, const int32_t *qz,
+                             int32_t *ax, int32_t *ay, int32_t *az, size_t n, int32_t oneG) {
+    for (size_t i = 0; i < n; i++) {
+        int64_t w = qw[i], x = qx[i], y = qy[i], z = qz[i];
+        ax[i] -= q30Multiply((int32_t)((x*z - w*y) >> 29), oneG);
+        ay[i] -= q30Multiply((int32_t)((w*x + y*z) >> 29), oneG);
+        az[i] -= q30Multiply((int32_t)((w*w - x*x - y*y + z*z) >> 30), oneG);
+    }
+}
+
+// Rotate every vector by its quaternion, same as VectorInt16::rotate(), with
+// v' = v + w*t + q x t and t = 2 * (q x v) instead of two quaternion products.
+// t keeps 8 fractional bits so the result is off by at most about one count,
+// which holds the products in 64 bits for components up to +-2^20.
+inline void q30Rotate(const int32_t *qw, const int32_t *qx, const int32_t *qy, const int32_t *qz,
+                      int32_t *vx, int32_t *vy, int32_t *vz, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        int64_t w = qw[i], x = qx[i], y = qy[i], z = qz[i];
+        int64_t px = vx[i], py = vy[i], pz = vz[i];
+        int64_t tx = (y*pz - z*py + ((int64_t)1 << 20)) >> 21;
+        int64_t ty = (z*px - x*pz + ((int64_t)1 << 20)) >> 21;
+        int64_t tz = (x*py - y*px + ((int64_t)1 << 20)) >> 21;
+        vx[i] = (int32_t)(px + ((w*tx + y*tz - z*ty + ((int64_t)1 << 37)) >> 38));
+        vy[i] = (int32_t)(py + ((w*ty + z*tx - x*tz + ((int64_t)1 << 37)) >> 38));
+        vz[i] = (int32_t)(pz + ((w*tz + x*ty - y*tx + ((int64_t)1 << 37)) >> 38));
+    }
+}
+
+// Linear acceleration in the world frame for a whole block, same as
+// dmpGetGravity(), dmpGetLinearAccel() and dmpGetLinearAccelInWorld() per sample
+inline void q30LinearAccelInWorld(const int32_t *qw, const int32_t *qx, const int32_t *qy, const int32_t *qz,
+                                  int32_t *ax, int32_t *ay, int32_t *az, size_t n, int32_t oneG) {
+    q30RemoveGravity(qw, qx, qy, qz, ax, ay, az, n, oneG);
+    q30Rotate(qw, qx, qy, qz, ax, ay, az, n);
+}
+
+#endif /* _HELPER_3DMATH_H_ */
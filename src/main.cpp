@@ -1,57 +1,473 @@
 #include <Arduino.h>
-#include <Adafruit_MPU6050.h>
-#include <Adafruit_Sensor.h>
+#include <MPU6050.h>
 #include <Wire.h>
 #include <Esp.h>
+#include <esp_timer.h>
+#include <esp_sleep.h>
+#include <driver/gpio.h>
 #include <HTTPClient.h>
+#include <Preferences.h>
 #include <WiFi.h>
 #include <iostream>
 #include <map>
 #include <vector>
 #include <fstream>
 #include <sstream>
-#include <unordered_map>
-#include <queue>
+#include "Huffman.h"
+#include "Base91.h"
+#include "Packet.h"
+#include "PacketQueue.h"
+#include "FifoAcquisition.h"
+#include "JitterStats.h"
+#include "Pipeline.h"
+#include "SpscRing.h"
+#include "SampleBlock.h"
+#include "CalibrationStore.h"
+#include "I2cEngine.h"
+#include "MultiImu.h"
+#include "AuxSensors.h"
+#include "MotionCapture.h"
+#include "SensorProfile.h"
 
 // Define constants
 const char* WIFI_SSID = "Test Network";
 const char* WIFI_PASSWORD = "12345678";
 const char* SERVER_URL = "http://10.83.90.181:3001/wab";
+// Packet configuration: readings per packet and the compression algorithm
+const int PACKET_SIZE = 100;
+const bool USE_HUFFMAN = false;
+const bool USE_RLE = false;
+const bool USE_DELTA = false;
+const bool USE_NONE = true;
+// Run sampling (core 1) and compression (core 0) as separate pipeline stages instead of one after another in loop()
+const bool PIPELINED = true;
+// Transport mode: false = JSON bodies (Huffman payload in base91), true = binary packets as application/octet-stream (see Packet.h)
+const bool BINARY_TRANSPORT = false;
+
+// Acquisition modes
+enum AcquisitionMode {
+    ACQUIRE_POLLING,   // read the data registers sample by sample
+    ACQUIRE_FIFO,      // hardware-timed samples from the MPU6050 FIFO, drained whenever the loop gets to it
+    ACQUIRE_INTERRUPT, // like ACQUIRE_FIFO, but the data-ready interrupt wakes the reader for every sample
+};
+const AcquisitionMode ACQUISITION_MODE = ACQUIRE_FIFO;
+// Sensor profiles: sample rate, DLPF, full-scale ranges and FIFO contents (whether the temperature is in the frames), written
+// together as one burst configuration. Every packet carries the id of its profile. Switch at runtime with "p<id>" on the serial console
+const SensorProfile PROFILES[] = {
+    // id, name,           SMPLRT_DIV, DLPF,        accel / gyro full-scale,                  temperature divisor
+    {0, "posture 50 Hz",   19, MPU6050_DLPF_BW_20,  {MPU6050_ACCEL_FS_2, MPU6050_GYRO_FS_250},  25},
+    {1, "motion 100 Hz",   9,  MPU6050_DLPF_BW_42,  {MPU6050_ACCEL_FS_2, MPU6050_GYRO_FS_250},  50},
+    {2, "vibration 1 kHz", 0,  MPU6050_DLPF_BW_188, {MPU6050_ACCEL_FS_8, MPU6050_GYRO_FS_1000}, 500},
+};
+const size_t PROFILE_COUNT = sizeof(PROFILES) / sizeof(PROFILES[0]);
+const uint8_t STARTUP_PROFILE = 1;
+const uint8_t MPU_INT_PIN = 19; // GPIO connected to the INT pin of the MPU6050
+// Number of MPU6050s: the first one at 0x68 (AD0 low), a second one at 0x69 (AD0 high). With two sensors their FIFOs
+// are drained in turns and every packet carries one channel group per sensor. The interrupt mode paces the first sensor only,
+// two sensors use ACQUIRE_FIFO instead
+const uint8_t IMU_COUNT = 1;
+TwoWire *const SECOND_IMU_WIRE = nullptr; // bus of the second sensor, nullptr: the same bus as the first one (e.g. &Wire1 for its own bus)
+// External sensors on the auxiliary bus (XDA/XCL) of every MPU6050. The MPU6050 reads them at its sample rate and puts them into
+// its FIFO behind the gyro, so they arrive in the same burst read and become extra columns of every packet.
+// Build with -DIMU_AUX_CHANNELS=<bytes of all slaves / 2> to use them, 3 for the HMC5883L magnetometer below
+#if IMU_AUX_CHANNELS > 0
+constexpr AuxSlave AUX_SLAVES[] = {{0x1E, 0x03, 6, false}}; // HMC5883L: X, Z, Y, big endian
+constexpr AuxRegisterWrite AUX_INIT[] = {{0x1E, 0x00, 0x18}, {0x1E, 0x01, 0x20}, {0x1E, 0x02, 0x00}}; // 75Hz, +/-1.3Ga, continuous measurement
+constexpr uint8_t AUX_SLAVE_COUNT = sizeof(AUX_SLAVES) / sizeof(AUX_SLAVES[0]);
+constexpr size_t AUX_INIT_COUNT = sizeof(AUX_INIT) / sizeof(AUX_INIT[0]);
+#else
+constexpr const AuxSlave *AUX_SLAVES = nullptr;
+constexpr const AuxRegisterWrite *AUX_INIT = nullptr;
+constexpr uint8_t AUX_SLAVE_COUNT = 0;
+constexpr size_t AUX_INIT_COUNT = 0;
+#endif
+constexpr uint8_t AUX_FRAME_BYTES = auxFrameBytes(AUX_SLAVES, AUX_SLAVE_COUNT);
+static_assert(AUX_FRAME_BYTES == 2 * IMU_AUX_CHANNELS, "IMU_AUX_CHANNELS must match the auxiliary slaves");
+// Sample rate divisor per channel, 1: every sample. A decimated channel is left out of the readings and sent as a column of its own
+// with the time of every value. In the FIFO modes a decimated temperature is not put into the FIFO but read from its register
+const uint16_t CHANNEL_DIVISORS[IMU_CHANNELS] = {1, 1, 1, 1, 1, 1, 1}; // ImuChannel order: aX, aY, aZ, t (set by the profile), gX, gY, gZ
+const uint16_t AUX_CHANNEL_DIVISOR = 1; // every auxiliary channel
+// Motion-triggered capture: the ESP32 stays in light sleep with the radio off while the MPU6050 samples into its FIFO, the motion
+// interrupt (INT on MPU_INT_PIN) wakes it up to stream packets until nothing moved for MOTION_QUIET_MS. In between it wakes up
+// whenever the FIFO reaches FIFO_WATERMARK_FRAMES and keeps the newest PRE_TRIGGER_SAMPLES, they lead the first packet of a burst.
+// Takes the place of the pipeline, with ACQUIRE_FIFO and one sensor
+const bool MOTION_TRIGGERED = false;
+const uint8_t MOTION_THRESHOLD = 10;      // 2mg per LSB
+const uint8_t MOTION_DURATION = 5;        // ms above the threshold
+const uint32_t MOTION_QUIET_MS = 3000;
+const uint32_t FIFO_WATERMARK_FRAMES = 64;
+const size_t PRE_TRIGGER_SAMPLES = 50;
+const EnergyModel ENERGY_MODEL = {{0.8f, 40.0f, 120.0f}}; // mA in light sleep, awake, with WiFi on (ESP32 datasheet ballpark)
+static_assert(!MOTION_TRIGGERED || (ACQUISITION_MODE == ACQUIRE_FIFO && IMU_COUNT == 1), "motion-triggered capture reads one sensor's FIFO");
+static_assert(!MOTION_TRIGGERED || FIFO_WATERMARK_FRAMES * (FIFO_FRAME_SIZE + AUX_FRAME_BYTES) < MPU6050_FIFO_SIZE, "the FIFO must not overflow before the watermark");
+// Calibration: offsets found once are kept in NVS and restored at boot. Without usable offsets (none stored, another sensor,
+// or more than CALIBRATION_MAX_DRIFT degrees from the calibration temperature) the sensor is calibrated, it must lie flat and still
+const bool CALIBRATE_IF_NEEDED = true;
+const float CALIBRATION_MAX_DRIFT = 15.0f;
+const uint8_t CALIBRATION_LOOPS = 6;      // from scratch
+const uint8_t CALIBRATION_WARM_LOOPS = 2; // fine tuning, starting from the stored offsets
+
+// Create the sensor objects. imu and fifo are the first sensor, the only one most of the time
+MPU6050 imus[2] = {MPU6050(MPU6050_DEFAULT_ADDRESS), MPU6050(MPU6050_ADDRESS_AD0_HIGH, SECOND_IMU_WIRE)};
+FifoAcquisition<MPU6050> fifos[2] = {FifoAcquisition<MPU6050>(imus[0]), FifoAcquisition<MPU6050>(imus[1])};
+MPU6050 &imu = imus[0];
+FifoAcquisition<MPU6050> &fifo = fifos[0];
+const uint8_t IMU_ADDRESSES[2] = {MPU6050_DEFAULT_ADDRESS, MPU6050_ADDRESS_AD0_HIGH};
+TwoWire *const IMU_WIRES[2] = {&Wire, SECOND_IMU_WIRE ? SECOND_IMU_WIRE : &Wire};
+static_assert(IMU_COUNT >= 1 && IMU_COUNT <= 2, "one or two MPU6050s (0x68 and 0x69)");
+
+// I2C transactions queued by the acquisition code run on the bus task (core 0), Wire itself stays blocking.
+// Used to read the FIFO while the previous packet is compressed, see FifoSource::pause
+struct WireBus {
+    bool read(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, void *wireObj) {
+        return I2Cdev::readBytes(devAddr, regAddr, length, data, I2Cdev::readTimeout, wireObj) == (int8_t)length;
+    }
+    bool write(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, void *wireObj) {
+        return I2Cdev::writeBytes(devAddr, regAddr, length, data, wireObj);
+    }
+    void hold(uint32_t micros) {
+        vTaskDelay(pdMS_TO_TICKS((micros + 999) / 1000));
+    }
+};
+WireBus wireBus;
+I2cEngine<WireBus, 8> i2cEngine(wireBus);
+TaskHandle_t busTask = nullptr;
+
+void busStage(void *) {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        i2cEngine.runAll();
+    }
+}
 
-// Create a sensor object
-Adafruit_MPU6050 mpu;
-// Objects to load sensor data into
-sensors_event_t a, g, temp;
+bool submitI2C(I2cTransaction &t) {
+    if (!busTask || !i2cEngine.submit(t)) return false;
+    xTaskNotifyGive(busTask);
+    return true;
+}
+// The profile the sensors are configured with, owned by the acquisition code. changeProfile() asks for another one
+const SensorProfile *activeProfile = &PROFILES[0];
+std::atomic<uint8_t> requestedProfile(STARTUP_PROFILE);
+
+ChannelRates ratesOf(const SensorProfile &profile) {
+    return profileRates(profile, CHANNEL_DIVISORS, AUX_CHANNEL_DIVISOR);
+}
+
+// Interrupt driven sampling: the ISR notifies the reader task, which timestamps every wake-up
+TaskHandle_t samplerTask = nullptr;
+JitterHistogram jitter(10000, 100); // expected period is set in InterruptSource::begin, 100us bins
+portMUX_TYPE jitterLock = portMUX_INITIALIZER_UNLOCKED; // the sampler records, printMetrics() takes the bins and clears them
+uint32_t missedInterrupts = 0;      // data-ready interrupts that arrived while sampling, before the previous one was handled
+
+void IRAM_ATTR onDataReady() {
+    if (!samplerTask) return;
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(samplerTask, &woken);
+    if (woken) portYIELD_FROM_ISR();
+}
+
+// Samples travel from the acquisition code (sampler task) to the compressor through a lock-free ring, nothing is allocated per packet.
+// The ring holds a little over two packets, when the compressor falls behind the newest samples are dropped and counted.
+// A packet holds PACKET_SIZE samples of every sensor.
+const size_t PACKET_SAMPLES = PACKET_SIZE * IMU_COUNT;
+const size_t SAMPLE_RING_CAPACITY = IMU_COUNT > 1 ? 512 : 256;
+static_assert(SAMPLE_RING_CAPACITY >= 2 * PACKET_SAMPLES, "the sample ring must hold at least two packets");
+SpscRing<ImuSample, SAMPLE_RING_CAPACITY> sampleRing;
+// One block per sensor (a channel group of the packet), each one large enough for the whole packet in case one sensor runs ahead
+typedef SampleBlock<PACKET_SAMPLES> PacketBlock;
+PacketBlock packetBlocks[IMU_COUNT]; // the packet the compressor is working on, one column per channel and sensor
+uint64_t packetBase = 0; // time of its first sample, the time offsets of every group are taken from it
+const SensorProfile *packetProfile = &PROFILES[0]; // profile its samples were taken with
+ChannelRates packetRates = ratesOf(PROFILES[0]); // and the channel rates of that profile
+ImuSample sourceReadings[PACKET_SIZE]; // what the sampler got from the ImuSource, before it goes into the ring
+// Raw FIFO columns, only touched by the acquisition code. The pointers are set up in initMPU
+int16_t rawSamples[SAMPLE_CHANNELS][PACKET_SIZE];
+int16_t *rawColumns[SAMPLE_CHANNELS];
+
+uint64_t rawTimes[PACKET_SIZE];
+
+// Motion-triggered capture, see MOTION_TRIGGERED
+PreTriggerBuffer<PRE_TRIGGER_SAMPLES> preTrigger;
+MotionCapture motionCapture({0, MOTION_QUIET_MS * 1000}); // the watermark follows the profile, see captureConfig()
+
+// Microseconds since boot. Unlike micros() this does not wrap after 71 minutes
+uint64_t micros64() {
+    return (uint64_t)esp_timer_get_time();
+}
 
-// Define the data structure to store every value from one sensor reading
-struct Reading {
+// Turn n columns drained from one sensor's FIFO into samples, timed by their index in the FIFO and the sample period.
+// Slow channels that fell due are marked fresh on the newest sample, a temperature that is not in the frames is read for it
+void fifoColumnsToSamples(MPU6050 &device, FifoAcquisition<MPU6050> &source, ChannelRates &rates, size_t n, ImuSample *out) {
+    uint32_t due = rates.take(n);
+    if ((due >> IMU_TEMP) & 1 && !source.temperatureInFrames()) rawColumns[IMU_TEMP][n - 1] = device.getTemperature();
+    source.frameTimes(micros64(), n, rawTimes);
+    for (size_t i = 0; i < n; i++) {
+        out[i].timestamp = rawTimes[i];
+        for (size_t ch = 0; ch < SAMPLE_CHANNELS; ch++) out[i].values[ch] = rawColumns[ch][i];
+        out[i].fresh = rates.fastChannels();
+        out[i].device = 0; // MultiImuSource tags them when there are several sensors
+        out[i].profile = activeProfile->id;
+    }
+    out[n - 1].fresh |= due;
+}
+
+// Let a sensor read the auxiliary slaves, the init writes go through its bypass to its bus. Nothing to do without slaves
+bool beginAux(MPU6050 &device, TwoWire *wire) {
+    if (AUX_SLAVE_COUNT == 0) return true;
+    return beginAuxSlaves(device, AUX_SLAVES, AUX_SLAVE_COUNT, AUX_INIT, AUX_INIT_COUNT,
+                          [wire](uint8_t address, uint8_t reg, uint8_t value) { return I2Cdev::writeByte(address, reg, value, wire); });
+}
+
+// Register polling: one 14 byte burst per sample (plus one word per auxiliary channel), timed by the loop
+class PollingSource : public ImuSource {
 public:
-    float timestamp;
-    float gX,gY,gZ,aX,aY,aZ,t;
-    Reading(float timestamp, float gX, float gY, float gZ, float aX, float aY, float aZ, float t) {
-        this->timestamp = timestamp;
-        this->gX = gX;
-        this->gY = gY;
-        this->gZ = gZ;
-        this->aX = aX;
-        this->aY = aY;
-        this->aZ = aZ;
-        this->t = t;
+    PollingSource(MPU6050 &device, TwoWire *wire) : device(device), wire(wire) {}
+
+    bool begin() override {
+        if (!beginAux(device, wire)) return false;
+        rates = ratesOf(*activeProfile);
+        device.beginRegisterBatch();
+        applyProfile(device, *activeProfile);
+        return device.commitRegisterBatch();
+    }
 
+    size_t read(ImuSample *out, size_t maxSamples) override {
+        if (maxSamples == 0) return 0;
+        int16_t *v = out->values;
+        device.getMotion7(&v[IMU_AX], &v[IMU_AY], &v[IMU_AZ], &v[IMU_GX], &v[IMU_GY], &v[IMU_GZ], &v[IMU_TEMP]);
+        for (size_t i = 0; i < IMU_AUX_CHANNELS; i++) v[IMU_CHANNELS + i] = (int16_t)device.getExternalSensorWord(2 * i);
+        out->timestamp = micros64();
+        out->fresh = rates.fastChannels() | rates.take(1); // the burst has the temperature anyway, decimation saves payload here
+        out->device = 0;
+        out->profile = activeProfile->id;
+        return 1;
     }
+
+private:
+    MPU6050 &device;
+    TwoWire *wire;
+    ChannelRates rates;
 };
+
+// Drain the FIFO whenever it has frames. The CPU sleeps while the FIFO fills up.
+class FifoSource : public ImuSource {
+public:
+    FifoSource(MPU6050 &device, FifoAcquisition<MPU6050> &fifo, uint8_t address, TwoWire *wire)
+        : device(device), fifo(fifo), address(address), wire(wire) {}
+
+    // Also to switch profiles: the FIFO starts over with the new configuration
+    bool begin() override {
+        while (fifo.prefetchPending()) delay(1); // the bus task is still reading into the frame buffer
+        if (!beginAux(device, wire)) return false;
+        const SensorProfile &profile = *activeProfile;
+        rates = ratesOf(profile);
+        device.beginRegisterBatch();
+        applyProfile(device, profile);
+        fifo.begin(profile.rateDivider, profile.dlpfMode, AUX_FRAME_BYTES, rates.isFast(IMU_TEMP));
+        return device.commitRegisterBatch();
+    }
+
+    // The bus task collects the next packet's frames while this one is compressed (or handed to the compressor task)
+    void pause() override {
+        fifo.prefetch(submitI2C, address, PACKET_SIZE, wire);
+    }
+
+    size_t read(ImuSample *out, size_t maxSamples) override {
+        for (;;) {
+            size_t n = poll(out, maxSamples);
+            if (n > 0) return n;
+            delay(1);
+        }
+    }
+
+    size_t poll(ImuSample *out, size_t maxSamples) override {
+        if (maxSamples > (size_t)PACKET_SIZE) maxSamples = PACKET_SIZE;
+        size_t n = fifo.drain(rawColumns, 0, maxSamples); // 0 while a prefetch is still running
+        if (n > 0) fifoColumnsToSamples(device, fifo, rates, n, out);
+        return n;
+    }
+
+private:
+    MPU6050 &device;
+    FifoAcquisition<MPU6050> &fifo;
+    uint8_t address;
+    TwoWire *wire;
+    ChannelRates rates;
+};
+
+// Block until the data-ready interrupt fires, then drain the FIFO. Every wake-up is timestamped with micros()
+// for the jitter histogram, the samples themselves are timed by the sensor clock like in FifoSource.
+class InterruptSource : public ImuSource {
+public:
+    bool begin() override {
+        while (fifo.prefetchPending()) delay(1);
+        if (!beginAux(imu, IMU_WIRES[0])) return false;
+        const SensorProfile &profile = *activeProfile;
+        rates = ratesOf(profile);
+        imu.beginRegisterBatch(); // profile, FIFO and interrupt setup go out as a few burst writes
+        applyProfile(imu, profile);
+        fifo.begin(profile.rateDivider, profile.dlpfMode, AUX_FRAME_BYTES, rates.isFast(IMU_TEMP));
+        portENTER_CRITICAL(&jitterLock);
+        jitter.setPeriod(fifo.samplePeriod());
+        portEXIT_CRITICAL(&jitterLock);
+        samplerTask = xTaskGetCurrentTaskHandle(); // setup() and loop() share the Arduino loop task
+        imu.setInterruptLatch(false); // 50us pulse per event, so no edge gets swallowed by a pending latch
+        imu.setIntEnabled(0);
+        imu.setIntDataReadyEnabled(true);
+        imu.setIntFIFOBufferOverflowEnabled(true);
+        if (!imu.commitRegisterBatch()) return false;
+        imu.getIntStatus(); // clear anything that is pending
+        pinMode(MPU_INT_PIN, INPUT);
+        attachInterrupt(digitalPinToInterrupt(MPU_INT_PIN), onDataReady, RISING);
+        return true;
+    }
+
+    void pause() override {
+        fifo.prefetch(submitI2C, MPU6050_DEFAULT_ADDRESS, PACKET_SIZE);
+    }
+
+    // Interrupts that piled up while the previous packet was compressed are not jitter, their frames wait in the FIFO
+    void resume() override {
+        ulTaskNotifyTake(pdTRUE, 0);
+        portENTER_CRITICAL(&jitterLock);
+        jitter.restart();
+        portEXIT_CRITICAL(&jitterLock);
+    }
+
+    size_t read(ImuSample *out, size_t maxSamples) override {
+        if (maxSamples > (size_t)PACKET_SIZE) maxSamples = PACKET_SIZE;
+        for (;;) {
+            uint32_t pending = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(100));
+            uint32_t now = micros();
+            portENTER_CRITICAL(&jitterLock);
+            if (pending == 0) jitter.restart(); // no interrupt within 100ms, the next interval would be meaningless
+            else jitter.record(now);
+            portEXIT_CRITICAL(&jitterLock);
+            if (pending == 0) continue;
+            if (pending > 1) missedInterrupts += pending - 1;
+
+            size_t n = fifo.drain(rawColumns, 0, maxSamples);
+            if (n > 0) {
+                fifoColumnsToSamples(imu, fifo, rates, n, out);
+                return n;
+            }
+        }
+    }
+
+private:
+    ChannelRates rates;
+};
+
+PollingSource pollingSources[2] = {PollingSource(imus[0], IMU_WIRES[0]), PollingSource(imus[1], IMU_WIRES[1])};
+FifoSource fifoSources[2] = {FifoSource(imus[0], fifos[0], IMU_ADDRESSES[0], IMU_WIRES[0]),
+                             FifoSource(imus[1], fifos[1], IMU_ADDRESSES[1], IMU_WIRES[1])};
+InterruptSource interruptSource;
+// Two sensors: the FIFO drains (or register reads) of both interleave
+ImuSource *const pollingSourceList[2] = {&pollingSources[0], &pollingSources[1]};
+ImuSource *const fifoSourceList[2] = {&fifoSources[0], &fifoSources[1]};
+MultiImuSource multiSource(ACQUISITION_MODE == ACQUIRE_POLLING ? pollingSourceList : fifoSourceList, IMU_COUNT, [] { delay(1); });
+ImuSource *imuSource = IMU_COUNT > 1                         ? (ImuSource *)&multiSource
+                     : ACQUISITION_MODE == ACQUIRE_INTERRUPT ? (ImuSource *)&interruptSource
+                     : ACQUISITION_MODE == ACQUIRE_FIFO      ? (ImuSource *)&fifoSources[0]
+                                                             : (ImuSource *)&pollingSources[0];
+
 // Define the data structure to store every important value needed after running Huffman Coding
 struct Huffman {
     std::vector<char> chars;
-    std::vector<int> freqs;
-    std::string base91;
+    std::vector<uint8_t> lengths; // code length of every char, the receiver rebuilds the canonical codes from these alone
+    std::vector<uint8_t> data; // packed code bits, base91 encoded straight into the HTTP body
     unsigned int safe_bits;
     unsigned int originalSize;
 };
 
+// Calibration record in NVS, survives reboots and firmware updates. One key per sensor
+class NvsCalibrationStorage : public CalibrationStorage {
+public:
+    NvsCalibrationStorage(const char *key) : key(key) {}
+
+    bool read(uint8_t *data, size_t length) override {
+        Preferences prefs;
+        if (!prefs.begin("imu", true)) return false;
+        size_t n = prefs.getBytes(key, data, length);
+        prefs.end();
+        return n == length;
+    }
+
+    bool write(const uint8_t *data, size_t length) override {
+        Preferences prefs;
+        if (!prefs.begin("imu", false)) return false;
+        size_t n = prefs.putBytes(key, data, length);
+        prefs.end();
+        return n == length;
+    }
+
+private:
+    const char *key;
+};
+
+NvsCalibrationStorage calibrationStorage[2] = {NvsCalibrationStorage("calibration"), NvsCalibrationStorage("calibration1")};
+
+DeviceFingerprint readFingerprint(MPU6050 &imu, uint8_t address) {
+  DeviceFingerprint device;
+  device.address = address;
+  device.deviceId = imu.getDeviceID();
+  device.trims[0] = imu.getAccelXSelfTestFactoryTrim();
+  device.trims[1] = imu.getAccelYSelfTestFactoryTrim();
+  device.trims[2] = imu.getAccelZSelfTestFactoryTrim();
+  device.trims[3] = imu.getGyroXSelfTestFactoryTrim();
+  device.trims[4] = imu.getGyroYSelfTestFactoryTrim();
+  device.trims[5] = imu.getGyroZSelfTestFactoryTrim();
+  return device;
+}
+
+// Restore the stored offsets of sensor d (two burst writes). Calibrate only when they are missing or stale, a stale record
+// still saves most of the work: the PID starts from the offsets it restored.
+void restoreCalibration(uint8_t d) {
+  MPU6050 &imu = imus[d];
+  DeviceFingerprint device = readFingerprint(imu, IMU_ADDRESSES[d]);
+  CalibrationRecord stored;
+  bool loaded = loadCalibration(calibrationStorage[d], stored);
+  CalibrationStatus status = checkCalibration(loaded ? &stored : nullptr, device, imu.getTemperature(), CALIBRATION_MAX_DRIFT);
+  if (status >= CALIBRATION_STALE) imu.SetActiveOffsets(stored.offsets);
+  if (status == CALIBRATION_VALID || !CALIBRATE_IF_NEEDED) {
+    Serial.println(status == CALIBRATION_VALID ? "Restored calibration offsets" : "Running without valid calibration offsets");
+    return;
+  }
+
+  uint8_t loops = status == CALIBRATION_STALE ? CALIBRATION_WARM_LOOPS : CALIBRATION_LOOPS;
+  Serial.print("Calibrating");
+  imu.CalibrateAccel(loops);
+  imu.CalibrateGyro(loops);
+  Serial.println();
+
+  CalibrationRecord fresh;
+  fresh.device = device;
+  const int16_t *offsets = imu.GetActiveOffsets();
+  for (int i = 0; i < 6; i++) fresh.offsets[i] = offsets[i];
+  fresh.temperature = imu.getTemperature();
+  if (!saveCalibration(calibrationStorage[d], fresh)) Serial.println("Failed to store calibration offsets");
+}
+
 // MPU functions
 void initMPU(){
-  if (!mpu.begin()) {
+  for (size_t ch = 0; ch < SAMPLE_CHANNELS; ch++) rawColumns[ch] = rawSamples[ch];
+  Wire.begin();
+  if (IMU_COUNT > 1 && IMU_WIRES[1] != &Wire) IMU_WIRES[1]->begin(); // a bus of its own
+  xTaskCreatePinnedToCore(busStage, "i2c", 4096, nullptr, 2, &busTask, 0);
+  bool found = true;
+  for (uint8_t d = 0; d < IMU_COUNT; d++) {
+    imus[d].setRegisterCacheEnabled(true); // configuration registers are only ever written by us, skip the read-modify-write reads
+    imus[d].initialize(); // +/- 2g, +/- 250 deg/s
+    if (!imus[d].testConnection()) {
+      found = false;
+      break;
+    }
+    restoreCalibration(d);
+  }
+  const SensorProfile *profile = findProfile(PROFILES, PROFILE_COUNT, STARTUP_PROFILE);
+  if (profile) activeProfile = profile;
+  requestedProfile = activeProfile->id;
+  if (!found || !imuSource->begin()) {
     Serial.println("Failed to find MPU6050 chip");
     while (1) {
       delay(10);
@@ -60,19 +476,17 @@ void initMPU(){
   Serial.println("MPU6050 Found!");
 }
 
-// Convert an std::vector of foats to a json array in std::string representation
-std::string vectorToJSONArray(const std::vector<float> &data) {
+// Append a column of integers as a json array (followed by a comma) to a std::string
+void appendJSONArray(std::string &out, const int32_t *data, size_t n) {
 
-    if (data.empty()) return "[],";
-    std::string jsonString = "[";
-    for (int i = 0; i < data.size(); ++i) {
+    out += "[";
+    for (size_t i = 0; i < n; ++i) {
         
-        jsonString += std::to_string(data.data()[i]);
+        out += std::to_string(data[i]);
         
-        if (i + 1 < data.size()) jsonString += ",";
+        if (i + 1 < n) out += ",";
     }
-    jsonString += "],";
-    return jsonString;
+    out += "],";
 }
 
 
@@ -89,87 +503,208 @@ void connectToWiFi() {
     Serial.printf("\nConnected to %s.\n", WIFI_SSID);
 }
 
+// Long-lived HTTP sender: keeps one keep-alive connection to SERVER_URL open across packets instead of
+// doing a TCP handshake per packet. The connection is (re)established lazily on the next post after a failure.
+class HttpSender : public PacketSink {
+public:
+    bool send(const OutgoingPacket &packet) override {
+        return post(packet.contentType, packet.body.data(), packet.body.size());
+    }
+
+    // POST a body, returns true if the server answered. The latency of the request is recorded either way.
+    bool post(const char *contentType, const uint8_t *body, size_t size) {
+        if (WiFi.status() != WL_CONNECTED) return false;
+
+        if (!connected) {
+            http.setReuse(true); // send "Connection: keep-alive" and keep the socket after a request
+            connected = http.begin(client, SERVER_URL);
+            if (!connected) {
+                Serial.println("Not connected!");
+                failures++;
+                return false;
+            }
+            connects++;
+        }
+
+        http.addHeader("Content-Type", contentType);
+
+        uint32_t start = micros();
+        int httpCode = http.POST((uint8_t *)body, size);
+        if (httpCode > 0) http.getString(); // drain the response so the connection can be reused
+        lastLatency = micros() - start;
+        totalLatency += lastLatency;
+        requests++;
+
+        if (httpCode <= 0) {
+            Serial.printf("Error: %s\n", http.errorToString(httpCode).c_str());
+            disconnect(); // reconnect with the next packet
+            failures++;
+            return false;
+        }
+        return true;
+    }
+
+    void disconnect() {
+        http.end();      // free internal resources
+        client.stop();   // close socket
+        connected = false;
+    }
+
+    uint32_t lastLatencyMicros() const { return lastLatency; }
+    uint32_t averageLatencyMicros() const { return requests ? totalLatency / requests : 0; }
+    uint32_t requestCount() const { return requests; }
+    uint32_t failureCount() const { return failures; }
+    uint32_t connectCount() const { return connects; }
+
+private:
+    WiFiClient client;
+    HTTPClient http;
+    bool connected = false;
+    uint32_t lastLatency = 0;
+    uint64_t totalLatency = 0;
+    uint32_t requests = 0;
+    uint32_t failures = 0;
+    uint32_t connects = 0;
+};
+
+HttpSender sender;
+
+// Packets are sent by a separate task, so sampling and compression continue while a POST is in flight.
+// When the sender falls behind, the oldest waiting packet is dropped.
+const size_t SEND_QUEUE_DEPTH = 4;
+PacketQueue sendQueue(SEND_QUEUE_DEPTH, PACKET_DROP_OLDEST);
+SenderWorker senderWorker(sendQueue, sender);
+
+// Sender task, runs on core 0 next to the WiFi stack
+void senderTask(void *) {
+    senderWorker.run();
+    vTaskDelete(nullptr);
+}
+
+void startSenderTask() {
+    xTaskCreatePinnedToCore(senderTask, "sender", 8192, nullptr, 1, nullptr, 0);
+}
+
+// Queue a body for the sender task
+void enqueueHTTP(const char *contentType, std::vector<uint8_t> &&body) {
+    OutgoingPacket packet;
+    packet.contentType = contentType;
+    packet.body = std::move(body);
+    sendQueue.push(std::move(packet));
+}
+
+void enqueueHTTP(const char *contentType, const std::string &body) {
+    enqueueHTTP(contentType, std::vector<uint8_t>(body.begin(), body.end()));
+}
+
+// Column order of the JSON representations: timestamp, then gX, gY, gZ, aX, aY, aZ, t and the auxiliary channels
+const uint8_t JSON_CHANNEL_ORDER[IMU_CHANNELS] = {IMU_GX, IMU_GY, IMU_GZ, IMU_AX, IMU_AY, IMU_AZ, IMU_TEMP};
+
+// Channel of the k-th JSON column after the timestamp
+size_t jsonChannel(size_t k) {
+    return k < IMU_CHANNELS ? JSON_CHANNEL_ORDER[k] : k;
+}
+
+// Header information of the packet the compressor is working on
+PacketMeta packetMeta() {
+    PacketMeta meta;
+    meta.scale = packetProfile->scale;
+    meta.baseMicros = packetBase;
+    meta.groups = IMU_COUNT;
+    meta.profile = packetProfile->id;
+    meta.periodMicros = profilePeriodMicros(*packetProfile);
+    meta.slowCount = 0;
+    for (size_t ch = 0; ch < SAMPLE_CHANNELS && meta.slowCount < PACKET_MAX_SLOW_CHANNELS; ch++) {
+        if (!packetRates.isFast(ch)) meta.slow[meta.slowCount++] = {(uint8_t)ch, packetRates.divisor(ch)};
+    }
+    return meta;
+}
+
+// The same as JSON members: full-scale ranges of the raw counts (see ACCEL_LSB_PER_G / GYRO_LSB_PER_DPS in Imu.h), the profile
+// and its sample period, and the time of the first sample in microseconds, every sample carries its offset from it. With several sensors
+// also their number, the readings are then one array per sensor. With decimated channels the divisor of every channel
+// in JSON column order, the ones above 1 follow the readings as columns of their own
+std::string metaJSON() {
+    std::string meta = ",\"accel_range\":" + std::to_string(packetProfile->scale.accelRange) +
+                       ",\"gyro_range\":" + std::to_string(packetProfile->scale.gyroRange) +
+                       ",\"profile\":" + std::to_string(packetProfile->id) +
+                       ",\"period_us\":" + std::to_string(profilePeriodMicros(*packetProfile)) +
+                       ",\"base_us\":" + std::to_string(packetBase);
+    if (IMU_COUNT > 1) meta += ",\"groups\":" + std::to_string(IMU_COUNT);
+    if (packetRates.slowChannels() != 0) {
+        meta += ",\"divisors\":[";
+        for (size_t i = 0; i < SAMPLE_CHANNELS; i++) {
+            if (i > 0) meta += ",";
+            meta += std::to_string(packetRates.divisor(jsonChannel(i)));
+        }
+        meta += "]";
+    }
+    return meta;
+}
+
+// Send a binary packet as it is
+void sendHTTP(std::vector<uint8_t> packet) {
+    enqueueHTTP("application/octet-stream", std::move(packet));
+}
 // Send Huffman coded data
 void sendHTTP(const Huffman &data) {
     //Serial.printf("SendHTTP called\n");
-    if (WiFi.status() == WL_CONNECTED) {
-        //Serial.println("Sending huffman data...");
-        WiFiClient client;
-        HTTPClient http;
-
-        if (http.begin(client, SERVER_URL)) {
-            http.addHeader("Content-Type", "application/json");
-
-            std::string body;
-            body += "{\"chars\":[";
-            for (char c : data.chars) {
-                body += "\"";
-                body += c;
-                body += "\",";
-            }
-            if (!data.chars.empty()) body.pop_back();
-            body += "],\"freqs\":[";
-            for (int freq : data.freqs) {
-                body += std::to_string(freq);
-                body += ",";
-            }
-            if (!data.freqs.empty()) body.pop_back();
-            body += "],";
-            body += "\"safe_bits\":" + std::to_string(data.safe_bits);
-            body += ",\"original_size\":" + std::to_string(data.originalSize);
-            body += ",\"base91\":\"";
-            body += data.base91;
-            body += "\"}";
-
-            int httpCode = http.POST(body.c_str());
-            if (httpCode <= 0) Serial.printf("Error: %s\n", http.errorToString(httpCode).c_str());
-
-            http.end();      // free internal resources
-            client.stop();   // close socket
-        } else {
-            Serial.println("Not connected!");
-        }
+    if (BINARY_TRANSPORT) { // code table and packed bits as they are, no base91 and no JSON
+        sendHTTP(buildPacket(PACKET_CODEC_HUFFMAN, packetMeta(), data.originalSize, data.safe_bits, data.chars, data.lengths,
+                             data.data.data(), data.data.size()));
+        return;
+    }
+    std::string body;
+    body.reserve(64 + data.chars.size() * 12 + base91EncodedMaxLength(data.data.size()));
+    body += "{\"chars\":[";
+    for (char c : data.chars) {
+        body += "\"";
+        body += c;
+        body += "\",";
+    }
+    if (!data.chars.empty()) body.pop_back();
+    body += "],\"lengths\":[";
+    for (uint8_t len : data.lengths) {
+        body += std::to_string(len);
+        body += ",";
     }
+    if (!data.lengths.empty()) body.pop_back();
+    body += "],";
+    body += "\"safe_bits\":" + std::to_string(data.safe_bits);
+    body += ",\"original_size\":" + std::to_string(data.originalSize);
+    body += metaJSON();
+    body += ",\"base91\":\"";
+    size_t offset = body.size();
+    body.resize(offset + base91EncodedMaxLength(data.data.size()));
+    body.resize(offset + base91Encode(data.data.data(), data.data.size(), &body[offset]));
+    body += "\"}";
+
+    enqueueHTTP("application/json", body);
 }
 // Send a std::string
 void sendHTTP(std::string data) {
-    if (WiFi.status() == WL_CONNECTED) {
-        HTTPClient http;
-        http.begin(SERVER_URL);
-        http.addHeader("Content-Type", "application/json");
-
-        std::string payload;
-        payload += "{\"value\":\"";
-        payload += data;
-        
-        payload += "\"}";
+    std::string payload;
+    payload += "{\"value\":\"";
+    payload += data;
 
-        http.POST(payload.c_str());
+    payload += "\"";
+    payload += metaJSON();
+    payload += "}";
 
-        
-        http.end();
-    }
+    enqueueHTTP("application/json", payload);
 }
 // Send a std::string with information about original data size in bits
 void sendHTTP(std::string data, int bits) {
-    if (WiFi.status() == WL_CONNECTED) {
-        HTTPClient http;
-        http.begin(SERVER_URL);
-        http.addHeader("Content-Type", "application/json");
-
-        std::string payload;
-        payload += "{\"value\":\"";
-        payload += data;
-        
-        payload += "\",\"original_size\":";
-        payload += std::to_string(bits);
-        payload += "}";
+    std::string payload;
+    payload += "{\"value\":\"";
+    payload += data;
 
-        http.POST(payload.c_str());
+    payload += "\",\"original_size\":";
+    payload += std::to_string(bits);
+    payload += metaJSON();
+    payload += "}";
 
-        
-        http.end();
-    }
+    enqueueHTTP("application/json", payload);
 }
 
 
@@ -199,114 +734,21 @@ std::string runLengthEncode(std::string str)
     return temp;					// Time complexity: O(1)
 }
 
-// Delta Encoding
-std::vector<float> deltaEncode(std::vector<float> values) {
-
-    std::vector<float> result;// Time complexity: O(1)
-    result.reserve(values.size());
-
-    // Cannot compress anything if the array consists of one element
-    if (values.size()==1) return values;// Time complexity: O(1)
+// Delta Encoding of one column into out, the first value is kept as it is
+template<typename T>
+void deltaEncode(const T *values, size_t n, int32_t *out) {
 
+    // Nothing to do for an empty column
+    if (n == 0) return;                         // Time complexity: O(1)
 
-    result.push_back(values.data()[0]);// Time complexity: O(1)
-    // Calculate differences for each index and add those to the result
-    for (int i = 1; i < values.size(); i++) {   // Time complexity O(n - 1)
-        float prev = values.data()[i-1];          // Time complexity: O(1)
-        float curr = values.data()[i];            // Time complexity: O(1)
-        result.push_back(curr - prev);          // Time complexity: O(1)
+    out[0] = values[0];                         // Time complexity: O(1)
+    // Calculate differences for each index, unsigned timestamps wrap correctly
+    for (size_t i = 1; i < n; i++) {            // Time complexity O(n - 1)
+        out[i] = (int32_t)(values[i] - values[i - 1]); // Time complexity: O(1)
     }
-
-    return result;                              // Time complexity: O(1)
-}
-
-// Huffman Coding with helper functions
-
-// Data structure for the nodes in the Huffman Tree
-class Node {
-public:
-    char ch;
-	int freq;
-	Node *left;
-    Node *right;
-	Node(char c, int f) { // Everything here has a time complexity of O(1)
-		ch = c;
-        freq = f;
-		left = nullptr;
-		right = nullptr;
-	}
-};
-
-// This class ensures that the queue is always sorted by frequency ascending
-class Compare {
-public:
-	bool operator() (Node* a, Node* b) {
-		return a->freq > b->freq; // Time complexity: O(1)
-	}
-};
-
-// Traverse the huffman tree in preorder and output the data of leaf nodes into the unordered map
-// The function is recursive, however every node is traversed only once, therefore this scales linear with O(n)
-void preOrder(Node* root, std::unordered_map<char, std::string> &codes, std::string curr) {
-	if (root == nullptr) return;                            // Time complexity: O(1)
-
-    // Only leaf nodes can contain a valid character for the Huffman codes
-	if (root->left == nullptr && root->right==nullptr) {    // Time complexity: O(1)
-		codes[root->ch] = curr;                             // Time complexity: O(1)
-		return;
-	}
-
-	preOrder(root->left, codes, curr + '0');                // Recursive call
-	preOrder(root->right, codes, curr + '1');               // Recursive call
-}
-
-// Function to delete every Node from memory after generating codes (Nodes are created in memory with "new", meaning we need to manually remove them)
-// This function has a time complexity of O(n), every Node is traversed once
-void freeTree(Node* root) {
-    if (!root) return;
-    freeTree(root->left);
-    freeTree(root->right);
-    delete root;
-}
-
-// returns a map of <symbol, huffman code> for the input char set and frequency set
-std::unordered_map<char, std::string> generateHuffmanCodes(std::string s,std::vector<int> freq) {
-	
-	int n = s.length();                                     // Time complexity: O(1)
-    
-    // priority queue
-	std::priority_queue<Node*, std::vector<Node*>, Compare> pq;
-	for (int i=0; i<n; i++) {  // Time complexity: O(n log n)
-		Node* tmp = new Node(s[i],freq[i]); // Time complexity: O(1)
-		pq.push(tmp); // Time complexity: O(log n)
-	}
-
-    // build Huffman tree
-	while (pq.size()>=2) { // Executes approximately n-1 times
-        // every iteration reduces pq by exactly one node (removes two, adds one)
-	    
-		Node* l = pq.top();                             // Time complexity: O(1)
-		pq.pop();                                       // Time complexity: O(1)
-
-		Node* r = pq.top();                             // Time complexity: O(1)
-		pq.pop();                                       // Time complexity: O(1)
-
-        // combine the lowest frequency nodes to a new node
-		Node* newNode = new Node('$',l->freq + r->freq); // $ = internal node | time complexity: O(1)
-		newNode->left = l;                              // Time complexity: O(1)
-		newNode->right = r;                             // Time complexity: O(1)
-
-		pq.push(newNode);                               // Time complexity: worst case O(log n)
-	}
-    // The total complexity of this loop is O(n log n), the inner body takes O(log n), iterated n-1 times.
-
-	Node* root = pq.top();                              // Time complexity: O(1)
-	std::unordered_map<char, std::string> codes;
-	preOrder(root, codes, "");                          // Time complexity: O(n)
-    freeTree(root);                                     
-	return codes;
 }
 
+// Huffman Coding with helper functions (tree, length limiting and canonical codes live in Huffman.h)
 
 // Templates to efficiently sort the calculated frequencies fro lowest to highest, which is needed for the huffman algorithm to work. Switches keys and values from the original map to achieve sorting by frequency
 template<typename A, typename B>
@@ -344,141 +786,192 @@ void generateCharAndFreq(const std::string &input, std::vector<char> &chars, std
     }
 }
 
-// Takes an std::string and the huffman table and outputs the huffman coded representation
-std::string encodeString(const std::string &input, const std::unordered_map<char, std::string> &codes) {
-    std::string encoded = "";
-    for (char c : input) {
-        encoded += codes.at(c);  // look up Huffman code for this char
-    }
-    return encoded;
-}
-
-/**
- * Encodes a string of binary characters ('0' and '1') into a base91 string.
- * To handle a raw bitstream, this function first pads the input binary string 
- * with '0's to make its length a multiple of 8. It then converts this padded 
- * string into a sequence of bytes. Finally, it applies the standard base91 
- * encoding algorithm to the byte sequence. The alphabet is changed where the "
- * character is replaced with ', because we cannot send " in json file safely
- * or it might be interpreted wrongfully
- */
-std::string encode_binary_string_to_base91(const std::string &binary_string) {
-    const std::string base91_chars =
-      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789!#$%&()*+,./:;<=>?@[]^_`{|}~'";
-
-    size_t total_bits = binary_string.size();
-    size_t pad = (8 - (total_bits % 8)) % 8;            // number of zeros to add
-    size_t padded_bits = total_bits + pad;
-
-    std::vector<uint8_t> data;
-    data.reserve((padded_bits + 7) / 8);
-
-    for (size_t i = 0; i < padded_bits; i += 8) { // every 8 bits to form a byte
-        uint8_t byte = 0;
-        for (size_t b = 0; b < 8; ++b) { // every bit
-            size_t idx = i + b; // start at the index of i 
-            char c = (idx < total_bits) ? binary_string[idx] : '0';
-            byte = (byte << 1) | static_cast<uint8_t>(c == '1'); // left shift adds 1, else 0
-        }
-        data.push_back(byte);
-    }
-
-    // Base91 encode | data is a vector containing 8-bit integers
-    std::string result;
-    result.reserve(data.size() * 2 + 4);
-
-    unsigned int bit_buffer = 0;
-    int num_bits = 0;
-
-    for (uint8_t byte : data) {
-        // Take next byte, put it into the bit buffer after the already present bits, update the bit count
-        bit_buffer |= (static_cast<unsigned int>(byte) << num_bits);
-        num_bits += 8;
-
-        while (num_bits > 13) {
-            unsigned int value = bit_buffer & 8191; // take the lowest 13 bits
-            if (value > 88) { // 13 bits fill only 8192 values, but base91 has 8281 values available. 
-                              //Sometimes we need to borrow one bit to not waste space
-                result.push_back(base91_chars[value % 91]); // remainder for first character
-                result.push_back(base91_chars[value / 91]); // quotient for second character
-                bit_buffer >>= 13; // remove the 13 bits that were processed
-                num_bits -= 13;
-            } else { // We use 14 bits for two characters 
-                value = bit_buffer & 16383; // 14 bits
-                result.push_back(base91_chars[value % 91]);
-                result.push_back(base91_chars[value / 91]);
-                bit_buffer >>= 14;
-                num_bits -= 14;
-            }
-        }
-    }
-
-    // There may be fewer than 13 bits left
-    if (num_bits > 0) {
-        result.push_back(base91_chars[bit_buffer % 91]);
-        if (num_bits > 7 || bit_buffer > 90) {
-            result.push_back(base91_chars[bit_buffer / 91]);
-        }
-    }
-
-    return result;
-}
-
-// This function combines all the steps for huffman coding with base91 encoding
+// This function combines all the steps for huffman coding, base91 encoding happens when the body is built
 Huffman huffmanEncode(std::string data) {
     std::vector<char> chars;
     std::vector<int> freqs;
 
     generateCharAndFreq(data, chars, freqs);
 
-    auto codes = generateHuffmanCodes(chars.data(), freqs);
-    std::string encoded = encodeString(data, codes);
+    HuffmanTable codes = generateHuffmanCodes(chars, freqs); // no code is longer than HUFFMAN_MAX_CODE_LENGTH
+    size_t bits = 0;
+    std::vector<uint8_t> encoded = packHuffmanBits(data, codes, bits);
 
     Serial.printf("%i,", ESP.getFreeHeap()); // Print free memory to the console AFTER compression
 
+    std::vector<uint8_t> lengths;
+    lengths.reserve(chars.size());
+    for (char c : chars) lengths.push_back(codes[(uint8_t)c].length);
 
-    return {chars, freqs, encode_binary_string_to_base91(encoded), encoded.size(), data.size() * 8};
+    return {chars, lengths, encoded, (unsigned int)bits, (unsigned int)data.size() * 8};
 }
 
-// Collect sensor data, execute compression and transmit via http. Select which compression algorithm to use and how big one packet of data is
-void collectSensorData(int packet_size, bool huffman, bool rle, bool delta, bool none) {
+// Ask the acquisition code to switch to another sensor profile between two reads. Returns false for an unknown id
+bool changeProfile(uint8_t id) {
+    if (!findProfile(PROFILES, PROFILE_COUNT, id)) return false;
+    requestedProfile = id;
+    return true;
+}
 
-    Serial.printf("%i,", ESP.getFreeHeap()); // Print free memory before compression
+// Acquisition side: switch to the profile changeProfile() asked for, returns true if it did. The sources are configured anew
+// and start over with an empty FIFO. Samples already in the ring keep the id of their profile and go out in packets of their own
+bool applyRequestedProfile() {
+    uint8_t id = requestedProfile;
+    if (id == activeProfile->id) return false;
+    const SensorProfile *profile = findProfile(PROFILES, PROFILE_COUNT, id);
+    if (!profile) return false;
+    activeProfile = profile;
+    if (!imuSource->begin()) Serial.printf("Failed to apply profile %u\n", id);
+    imuSource->resume();
+    return true;
+}
 
-    int start = millis();
+// Serial console: "p<id>" switches the sensor profile, e.g. "p2"
+void pollConsole() {
+    static char line[8];
+    static size_t length = 0;
+    while (Serial.available() > 0) {
+        char c = (char)Serial.read();
+        if (c != '\n' && c != '\r') {
+            if (length < sizeof(line) - 1) line[length++] = c;
+            continue;
+        }
+        line[length] = 0;
+        if (length >= 2 && line[0] == 'p') {
+            uint8_t id = (uint8_t)atoi(line + 1);
+            if (changeProfile(id)) Serial.printf("Switching to profile %u (%s)\n", id, findProfile(PROFILES, PROFILE_COUNT, id)->name);
+            else Serial.printf("Unknown profile %s\n", line + 1);
+        }
+        length = 0;
+    }
+}
+
+// Push packet_size samples from the selected ImuSource into the sample ring
+void acquireReadings(int packet_size) {
+    size_t count = 0;
+    while (count < (size_t)packet_size) {
+        size_t n = imuSource->read(sourceReadings, packet_size - count);
+        for (size_t i = 0; i < n; i++) sampleRing.push(sourceReadings[i]); // the compressor can pick them up right away
+        count += n;
+    }
+}
 
-    std::vector<Reading> readings;
-    readings.reserve(packet_size);
 
-    for (int i = 0; i < packet_size; i++) {
-        mpu.getEvent(&a, &g, &temp);
-        readings.emplace_back((float)millis(),
-                              g.gyro.x, g.gyro.y, g.gyro.z,
-                              a.acceleration.x, a.acceleration.y, a.acceleration.z,
-                              temp.temperature);
+// Move the oldest PACKET_SAMPLES samples out of the ring into the columns of their sensor's block. A packet holds the samples of
+// one profile only, the last packet before a profile change may come out short
+void fillPacket(PacketBlock *blocks) {
+    for (uint8_t d = 0; d < IMU_COUNT; d++) blocks[d].clear();
+    const ImuSample *first = sampleRing.peek();
+    if (first && first->profile != packetProfile->id) {
+        const SensorProfile *profile = findProfile(PROFILES, PROFILE_COUNT, first->profile);
+        if (profile) {
+            packetProfile = profile;
+            packetRates = ratesOf(*profile);
+        }
+    }
+    size_t n = 0;
+    for (const ImuSample *s; n < PACKET_SAMPLES && (s = sampleRing.peek(n)) && s->profile == first->profile; n++) {}
+    sampleRing.consume(n, [blocks](const ImuSample &sample) {
+        if (sample.device < IMU_COUNT) blocks[sample.device].append(sample);
+    });
+    packetBase = UINT64_MAX;
+    for (uint8_t d = 0; d < IMU_COUNT; d++) {
+        if (blocks[d].size() > 0 && blocks[d].baseTime() < packetBase) packetBase = blocks[d].baseTime();
     }
+    if (packetBase == UINT64_MAX) packetBase = 0;
+}
 
-    if (huffman || rle || none) {
-        // Generate a string representation for the readings in JSON
-        std::string stringRepr;
-        stringRepr.reserve(packet_size * 80);
-        stringRepr += "[";
+// Append sample i of a block as a JSON array of raw counts: [time offset (us),gX,gY,gZ,aX,aY,aZ,t,auxiliary channels...]
+// without the decimated channels
+void appendReadingJSON(std::string &out, const PacketBlock &block, size_t i) {
+    out += "[";
+    out += std::to_string(block.timestamp(i) - packetBase);
+    for (size_t k = 0; k < SAMPLE_CHANNELS; k++) {
+        size_t ch = jsonChannel(k);
+        if (!packetRates.isFast(ch)) continue;
+        out += ",";
+        out += std::to_string(block.column(ch)[i]);
+    }
+    out += "]";
+}
 
-        for (size_t i = 0; i < readings.size(); ++i) {
-            const Reading &r = readings.data()[i];
-            stringRepr += "[";
-            stringRepr += std::to_string(r.timestamp) + ",";
-            stringRepr += std::to_string(r.gX) + ",";
-            stringRepr += std::to_string(r.gY) + ",";
-            stringRepr += std::to_string(r.gZ) + ",";
-            stringRepr += std::to_string(r.aX) + ",";
-            stringRepr += std::to_string(r.aY) + ",";
-            stringRepr += std::to_string(r.aZ) + ",";
-            stringRepr += std::to_string(r.t);
-            stringRepr += "]";
-            if (i + 1 < readings.size()) stringRepr += ",";
+// Append the values of a decimated channel as [[time offset (us),value],...]
+void appendSlowColumnJSON(std::string &out, const PacketBlock &block, size_t ch) {
+    out += "[";
+    for (size_t j = 0; j < block.columnSize(ch); j++) {
+        if (j > 0) out += ",";
+        out += "[";
+        out += std::to_string(block.timestamp(block.sampleIndex(ch)[j]) - packetBase);
+        out += ",";
+        out += std::to_string(block.column(ch)[j]);
+        out += "]";
+    }
+    out += "]";
+}
+
+// Append every sample of a block as a JSON array of readings. With decimated channels: [[readings],[t column],...]
+void appendGroupJSON(std::string &out, const PacketBlock &block) {
+    bool slow = packetRates.slowChannels() != 0;
+    if (slow) out += "[";
+    out += "[";
+    for (size_t i = 0; i < block.size(); ++i) {
+        appendReadingJSON(out, block, i);
+        if (i + 1 < block.size()) out += ",";
+    }
+    out += "]";
+    if (!slow) return;
+    for (size_t k = 0; k < SAMPLE_CHANNELS; k++) {
+        size_t ch = jsonChannel(k);
+        if (packetRates.isFast(ch)) continue;
+        out += ",";
+        appendSlowColumnJSON(out, block, ch);
+    }
+    out += "]";
+}
+
+// Append the delta coded columns of a block: [time offsets],[gX],...,[t],[auxiliary channels]... (every array followed by a comma).
+// A decimated channel takes two arrays, the time offsets of its values and the values
+void appendDeltaGroupJSON(std::string &out, const PacketBlock &block) {
+    // Dont calculate differences in rows (between different sensors) but in columns (differences in readings by the same sensor).
+    // The block already stores every sensor as its own column, so each one is encoded in place
+    static int32_t deltas[PacketBlock::capacity()];
+    static uint32_t slowTimes[PacketBlock::capacity()];
+    size_t count = block.size();
+    deltaEncode(block.timeOffsets(), count, deltas);
+    if (count > 0) deltas[0] += (int32_t)(block.baseTime() - packetBase); // offsets of every group start from the packet base
+    appendJSONArray(out, deltas, count);
+    for (size_t k = 0; k < SAMPLE_CHANNELS; k++) {
+        size_t ch = jsonChannel(k);
+        size_t n = block.columnSize(ch);
+        if (!packetRates.isFast(ch)) {
+            for (size_t j = 0; j < n; j++) slowTimes[j] = (uint32_t)(block.timestamp(block.sampleIndex(ch)[j]) - packetBase);
+            deltaEncode(slowTimes, n, deltas);
+            appendJSONArray(out, deltas, n);
+        }
+        deltaEncode(block.column(ch), n, deltas);
+        appendJSONArray(out, deltas, n);
+    }
+}
+
+// Compress the readings with the selected algorithm and queue the result for transmission, "start" is when work on the packet began.
+// Every sensor's block is a channel group of its own: with one sensor the readings are a single array, with several one array per sensor
+void compressAndSend(const PacketBlock *blocks, bool huffman, bool rle, bool delta, bool none, int start) {
+
+    // Generate a string representation for the readings in JSON
+    std::string stringRepr;
+    stringRepr.reserve(PACKET_SAMPLES * 80);
+    if (IMU_COUNT == 1) {
+        appendGroupJSON(stringRepr, blocks[0]);
+    } else {
+        stringRepr += "[";
+        for (uint8_t d = 0; d < IMU_COUNT; d++) {
+            appendGroupJSON(stringRepr, blocks[d]);
+            if (d + 1 < IMU_COUNT) stringRepr += ",";
         }
         stringRepr += "]";
+    }
+
+    if (huffman || rle || none) {
 
         if (huffman) {
             Huffman hf = huffmanEncode(stringRepr); // Huffman Code JSON
@@ -488,89 +981,266 @@ void collectSensorData(int packet_size, bool huffman, bool rle, bool delta, bool
         if (rle) {
             std::string rlEncoded = runLengthEncode(stringRepr); // Run-Length Encode JSON
             Serial.printf("%i", millis() - start); // Print the number of ms the process took
-            sendHTTP(rlEncoded, stringRepr.size() * 8); // Transmit via HTTP, pass original data size in bits
+            if (BINARY_TRANSPORT) sendHTTP(buildPacket(PACKET_CODEC_RLE, packetMeta(), stringRepr.size() * 8, rlEncoded));
+            else sendHTTP(rlEncoded, stringRepr.size() * 8); // Transmit via HTTP, pass original data size in bits
         }
         if (none) {
             Serial.printf("%i,", ESP.getFreeHeap()); // Print free memory (no compression, just after generating sensor readings)
             Serial.printf("%i", millis() - start); // Print the number of ms the process took
-            sendHTTP(stringRepr); // Transmit via HTTP
+            if (BINARY_TRANSPORT) sendHTTP(buildPacket(PACKET_CODEC_NONE, packetMeta(), stringRepr.size() * 8, stringRepr));
+            else sendHTTP(stringRepr); // Transmit via HTTP
         }
     }
 
     if (delta) {
-        // Create a string representation in JSON so we can compare it afterwards
-        std::string stringRepr;
-        for (size_t i = 0; i < readings.size(); ++i) {
-            const Reading &r = readings.data()[i];
-            stringRepr += "[";
-            stringRepr += std::to_string(r.timestamp) + ",";
-            stringRepr += std::to_string(r.gX) + ",";
-            stringRepr += std::to_string(r.gY) + ",";
-            stringRepr += std::to_string(r.gZ) + ",";
-            stringRepr += std::to_string(r.aX) + ",";
-            stringRepr += std::to_string(r.aY) + ",";
-            stringRepr += std::to_string(r.aZ) + ",";
-            stringRepr += std::to_string(r.t);
-            stringRepr += "]";
-            if (i + 1 < readings.size()) stringRepr += ",";
+        // The JSON representation above is what the delta coded columns are compared against
+        std::string jsonString = "[";
+        if (IMU_COUNT == 1) {
+            appendDeltaGroupJSON(jsonString, blocks[0]);
+        } else {
+            for (uint8_t d = 0; d < IMU_COUNT; d++) {
+                jsonString += "[";
+                appendDeltaGroupJSON(jsonString, blocks[d]);
+                if (jsonString.back() == ',') jsonString.pop_back();
+                jsonString += "],";
+            }
         }
-        stringRepr += "]";
+        if (!jsonString.empty() && jsonString.back() == ',') jsonString.pop_back();
+        jsonString += "]";
 
-        // Change the dimensions of the sensor readings -> dont calculate differences in rows (between different sensors)
-        //              -> But in columns (differences in readings by the same sensor)
-        std::vector<std::vector<float>> deltaEncArr(8);
-        deltaEncArr.reserve(8);
-        
-        for (const Reading r : readings) {
-            deltaEncArr.data()[0].push_back(r.timestamp);
-            deltaEncArr.data()[1].push_back(r.gX);
-            deltaEncArr.data()[2].push_back(r.gY);
-            deltaEncArr.data()[3].push_back(r.gZ);
-            deltaEncArr.data()[4].push_back(r.aX);
-            deltaEncArr.data()[5].push_back(r.aY);
-            deltaEncArr.data()[6].push_back(r.aZ);
-            deltaEncArr.data()[7].push_back(r.t);
+        Serial.printf("%i,%i", ESP.getFreeHeap(), millis() - start); // Print free memory after compression and how long the process took
+        if (BINARY_TRANSPORT) sendHTTP(buildPacket(PACKET_CODEC_DELTA, packetMeta(), stringRepr.size() * 8, jsonString));
+        else sendHTTP(jsonString, stringRepr.size() * 8); // Transmit via HTTP, pass original data size in bits
+    }
+
+}
+
+// Collect sensor data, execute compression and transmit via http. Select which compression algorithm to use and how big one packet of data is
+void collectSensorData(int packet_size, bool huffman, bool rle, bool delta, bool none) {
+
+    Serial.printf("%i,", ESP.getFreeHeap()); // Print free memory before compression
+
+    int start = millis();
+
+    applyRequestedProfile();
+    imuSource->resume(); // nothing was read while the previous packet was compressed and sent
+    acquireReadings(packet_size * IMU_COUNT);
+    imuSource->pause(); // FIFO modes: the next frames are read in the background from here on
+    fillPacket(packetBlocks);
+    compressAndSend(packetBlocks, huffman, rle, delta, none, start);
+}
+
+#ifdef I2CDEV_STATS
+#define BUS_CSV_COLUMNS ",i2c (us),i2c transfers,i2c failures"
+// Time spent on the I2C bus since the previous log line, the transfers and how many of them failed or timed out
+void printBusMetrics() {
+    static I2CdevStats bus; // too big for the stack of the compressor task
+    I2Cdev::getStats(&bus, true); // and start over
+    uint64_t cycles = 0;
+    uint32_t transfers = bus.untracked, failures = 0;
+    for (uint8_t i = 0; i < bus.used; i++) {
+        cycles += bus.registers[i].cycles;
+        transfers += bus.registers[i].reads + bus.registers[i].writes;
+        failures += bus.registers[i].errors + bus.registers[i].timeouts;
+    }
+    Serial.printf(",%u,%u,%u", (unsigned int)(cycles / I2CDEV_STATS_CLOCK_MHZ()), transfers, failures);
+}
+#else
+#define BUS_CSV_COLUMNS ""
+void printBusMetrics() {}
+#endif
+
+#define CAPTURE_CSV_COLUMNS ",bursts,sleep (ms),awake (ms),radio (ms),charge (mC)"
+// Motion-triggered capture only: bursts so far, the time spent in light sleep, awake and with the radio on, and the charge that took
+void printCaptureMetrics() {
+    if (!MOTION_TRIGGERED) return;
+    motionCapture.account(micros64());
+    const CaptureStats &s = motionCapture.statistics();
+    Serial.printf(",%u,%u,%u,%u,%.1f", s.bursts, (unsigned int)(s.micros[POWER_SLEEP] / 1000), (unsigned int)(s.micros[POWER_AWAKE] / 1000),
+                  (unsigned int)(s.micros[POWER_RADIO] / 1000), captureCharge(s, ENERGY_MODEL));
+}
+
+// Interrupt mode only: one column per JitterHistogram bin, named after the deviation from the sample period in its middle
+void printJitterHeader() {
+    if (ACQUISITION_MODE != ACQUIRE_INTERRUPT) return;
+    for (int i = 0; i < JITTER_BINS; i++) Serial.printf(",jitter %+d us", (i - JITTER_BINS / 2) * (int)jitter.binWidth());
+}
+
+void printJitterBins(const JitterHistogram &histogram) {
+    if (ACQUISITION_MODE != ACQUIRE_INTERRUPT) return;
+    for (size_t i = 0; i < JITTER_BINS; i++) Serial.printf(",%u", histogram.bin(i));
+}
+
+// Finish a log line with the sender and sampling metrics
+void printMetrics() {
+    SenderMetrics m = sendQueue.snapshot(); // Duration of the last POST, packets waiting for the sender and packets lost so far
+    Serial.printf(",%u,%u,%u", m.lastSendMicros, (unsigned int)m.depth, m.dropped);
+    portENTER_CRITICAL(&jitterLock); // the jitter of the intervals since the previous log line
+    JitterHistogram interval = jitter;
+    jitter.clear();
+    portEXIT_CRITICAL(&jitterLock);
+    Serial.printf(",%u,%u", interval.peakDeviation(), missedInterrupts); // Interrupt mode only
+    Serial.printf(",%u,%u", fifo.statistics().overflows, fifo.statistics().droppedFrames); // FIFO modes: overflows and the frames they cost
+    Serial.printf(",%u,%u", (unsigned int)sampleRing.highWaterMark(), sampleRing.overflowCount()); // Fullest the sample ring got, samples lost to a full ring
+    printBusMetrics(); // I2CDEV_STATS builds only
+    printCaptureMetrics(); // MOTION_TRIGGERED only
+    printJitterBins(interval); // ACQUIRE_INTERRUPT only
+    Serial.print("\n"); // log -> new line
+}
+
+// --- Dual-core pipeline ---
+// The sampler task on core 1 pushes samples into the sample ring without ever waiting for the compressor,
+// the compressor task on core 0 takes a packet out of the ring as soon as one is complete and the sender task (core 0)
+// transmits in the background. Sampling of packet N+1 overlaps compression and transmission of packet N,
+// so the throughput is limited by the slowest stage instead of the sum of all stages.
+
+StageStats samplerStats = {};
+StageStats compressorStats = {};
+TaskHandle_t compressorTask = nullptr;
+
+// Pipeline.h signal on a FreeRTOS task notification: the sampler wakes the compressor task
+struct CompressorSignal {
+    void notify() { xTaskNotifyGive(compressorTask); }
+    void wait(uint32_t timeoutMs) { ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeoutMs)); }
+} compressorSignal;
+
+// Like collectSensorData, the FIFO modes prefetch between packets: instead of the sampler polling the FIFO every
+// millisecond, the bus task waits until a packet's frames are there and reads them in a few bursts
+void samplerStage(void *) {
+    for (;;) {
+        applyRequestedProfile();
+        imuSource->resume();
+        produceSamples(sampleRing, compressorSignal, samplerStats, PACKET_SAMPLES,
+                       [](SpscRing<ImuSample, SAMPLE_RING_CAPACITY> &) { acquireReadings(PACKET_SAMPLES); });
+        imuSource->pause();
+    }
+}
+
+void compressorStage(void *) {
+    for (;;) {
+        consumePacket(sampleRing, compressorSignal, compressorStats, PACKET_SAMPLES, [](SpscRing<ImuSample, SAMPLE_RING_CAPACITY> &) {
+            fillPacket(packetBlocks);
+            Serial.printf("%i,", millis()); // Start each log entry with a timestamp
+            Serial.printf("%i,", ESP.getFreeHeap()); // Print free memory before compression
+            compressAndSend(packetBlocks, USE_HUFFMAN, USE_RLE, USE_DELTA, USE_NONE, millis());
+            printMetrics();
+        }, 1000);
+    }
+}
+
+void startPipeline() {
+    TaskHandle_t sampler = nullptr;
+    TaskHandle_t compressor = nullptr;
+    xTaskCreatePinnedToCore(compressorStage, "compressor", 16384, nullptr, 1, &compressor, 0);
+    compressorTask = compressor; // before the sampler starts notifying it
+    xTaskCreatePinnedToCore(samplerStage, "sampler", 8192, nullptr, 3, &sampler, 1);
+    samplerTask = sampler; // the data-ready interrupt now wakes the sampler task
+}
+
+// --- Motion-triggered capture ---
+// MotionCapture runs the sleep / wake-up / burst state machine, this is the ESP32 side of it. The motion interrupt is latched,
+// INT stays high until INT_STATUS is read: a level the light sleep can wake up on, and the motion of a whole packet in one read.
+
+class LightSleepPlatform : public CapturePlatform {
+public:
+    uint64_t now() override { return micros64(); }
+
+    WakeCause sleep(uint32_t maxMicros) override {
+        imu.getIntStatus(); // clear the latch, INT goes low
+        Serial.flush();
+        esp_sleep_enable_timer_wakeup(maxMicros);
+        gpio_wakeup_enable((gpio_num_t)MPU_INT_PIN, GPIO_INTR_HIGH_LEVEL);
+        esp_sleep_enable_gpio_wakeup();
+        esp_light_sleep_start();
+        return esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_GPIO ? WAKE_MOTION : WAKE_WATERMARK;
+    }
+
+    void keepPreTrigger() override {
+        size_t n;
+        while ((n = imuSource->poll(sourceReadings, PACKET_SIZE)) > 0) {
+            for (size_t i = 0; i < n; i++) preTrigger.push(sourceReadings[i]);
         }
+    }
 
-        auto timestamp = deltaEncode(deltaEncArr.data()[0]);
-        auto gX = deltaEncode(deltaEncArr.data()[1]);
-        auto gY = deltaEncode(deltaEncArr.data()[2]);
-        auto gZ = deltaEncode(deltaEncArr.data()[3]);
-        auto aX = deltaEncode(deltaEncArr.data()[4]);
-        auto aY = deltaEncode(deltaEncArr.data()[5]);
-        auto aZ = deltaEncode(deltaEncArr.data()[6]);
-        auto t  = deltaEncode(deltaEncArr.data()[7]);
+    void radio(bool on) override {
+        if (on) {
+            WiFi.mode(WIFI_STA);
+            connectToWiFi();
+            return;
+        }
+        for (int i = 0; i < 500 && sendQueue.snapshot().depth > 0; i++) delay(10); // the sender finishes the burst, 5s at most
+        WiFi.disconnect(true);
+        WiFi.mode(WIFI_OFF);
+    }
 
-        std::string jsonString = "[";
-        jsonString += vectorToJSONArray(timestamp);
-        jsonString += vectorToJSONArray(gX);
-        jsonString += vectorToJSONArray(gY);
-        jsonString += vectorToJSONArray(gZ);
-        jsonString += vectorToJSONArray(aX);
-        jsonString += vectorToJSONArray(aY);
-        jsonString += vectorToJSONArray(aZ);
-        jsonString += vectorToJSONArray(t);
-        if (!jsonString.empty() && jsonString.back() == ',') jsonString.pop_back();
-        jsonString += "]";
+    void startBurst() override {
+        imuSource->resume();
+        preTrigger.consume([](const ImuSample &sample) { sampleRing.push(sample); });
+    }
 
-        Serial.printf("%i,%i", ESP.getFreeHeap(), millis() - start); // Print free memory after compression and how long the process took
-        sendHTTP(jsonString, stringRepr.size() * 8); // Transmit via HTTP, pass original data size in bits
+    // Like collectSensorData, but without a prefetch: the bus has to be idle when the CPU goes to sleep
+    bool capturePacket() override {
+        Serial.printf("%i,", millis()); // Start each log entry with a timestamp
+        Serial.printf("%i,", ESP.getFreeHeap()); // Print free memory before compression
+        int start = millis();
+        if (sampleRing.size() < PACKET_SAMPLES) acquireReadings(PACKET_SAMPLES - sampleRing.size()); // the pre-trigger history comes first
+        fillPacket(packetBlocks);
+        compressAndSend(packetBlocks, USE_HUFFMAN, USE_RLE, USE_DELTA, USE_NONE, start);
+        printMetrics();
+        return imu.getIntMotionStatus(); // anything since the previous packet
     }
+};
+
+LightSleepPlatform lightSleep;
+
+// The FIFO reaches the watermark after FIFO_WATERMARK_FRAMES sample periods of the active profile
+CaptureConfig captureConfig() {
+    return {FIFO_WATERMARK_FRAMES * profilePeriodMicros(*activeProfile), MOTION_QUIET_MS * 1000};
+}
 
+void initMotionCapture() {
+    imu.beginRegisterBatch();
+    imu.setDHPFMode(MPU6050_DHPF_5); // the motion detector looks at high-passed accel, the FIFO data is not filtered
+    imu.setMotionDetectionThreshold(MOTION_THRESHOLD);
+    imu.setMotionDetectionDuration(MOTION_DURATION);
+    imu.setInterruptLatch(true);
+    imu.setInterruptLatchClear(false); // cleared by reading INT_STATUS
+    imu.setIntEnabled(0);
+    imu.setIntMotionEnabled(true);
+    imu.commitRegisterBatch();
+    pinMode(MPU_INT_PIN, INPUT);
+    motionCapture.configure(captureConfig());
+    motionCapture.begin(micros64());
 }
 
 // Main ESP32 functions
 void setup() {
     Serial.begin(115200); // Enable reading from the serial console at 115200 BAUD rate
-    connectToWiFi();
+    if (!MOTION_TRIGGERED) connectToWiFi(); // a burst switches the radio on when it needs it
     initMPU();
-    Serial.println("time,mem (start),mem (end),lat"); // for csv purposes, there are the column heads
+    startSenderTask();
+    if (MOTION_TRIGGERED) initMotionCapture();
+    else if (PIPELINED) startPipeline();
+    Serial.print("time,mem (start),mem (end),lat,send (us),queued,dropped,jitter (us),missed,overflows,fifo dropped,ring hw,ring overflows" BUS_CSV_COLUMNS); // for csv purposes, there are the column heads
+    Serial.print(MOTION_TRIGGERED ? CAPTURE_CSV_COLUMNS : "");
+    printJitterHeader();
+    Serial.println();
 }
 
 void loop() {
+    pollConsole();
+    if (MOTION_TRIGGERED) { // one wake-up or one packet of a burst
+        if (motionCapture.state() == CAPTURE_IDLE && applyRequestedProfile()) motionCapture.configure(captureConfig());
+        motionCapture.step(lightSleep);
+        return;
+    }
+    if (PIPELINED) { // the pipeline tasks do all the work, the loop only listens to the console
+        delay(100);
+        return;
+    }
     Serial.printf("%i,", millis()); // Start each log entry with a timestamp
-    collectSensorData(100, false, false, false, true); // Main process -> 100 readings per packet, Huffman Coding is selected
-    Serial.print("\n"); // log -> new line
+    collectSensorData(PACKET_SIZE, USE_HUFFMAN, USE_RLE, USE_DELTA, USE_NONE); // Main process
+    printMetrics();
 }
 
 /* --- use this code to get available memory ---
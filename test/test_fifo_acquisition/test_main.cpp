@@ -0,0 +1,144 @@
+// FifoAcquisition and MPU6050_Base::getFIFOPackets() (MPU6050_readFIFOPackets) against SimulatedMpu6050:
+// burst drains, overflow realignment, the partial frame discarded at the head and the droppedFrames accounting
+// of frameTimes(). pio test -e native -f test_fifo_acquisition
+
+#include <unity.h>
+#include "FifoAcquisition.h"
+#include "SimulatedMpu6050.h"
+
+void setUp() {}
+void tearDown() {}
+
+const uint8_t RATE_DIVIDER = 9; // with DLPF 3: 100 Hz
+const uint8_t DLPF_MODE = 3;
+const uint32_t PERIOD = 10000;
+
+// Sensor, acquisition and a host clock that moves one sample period per frame
+struct Rig {
+    SimulatedMpu6050 imu;
+    FifoAcquisition<SimulatedMpu6050> fifo;
+    int16_t data[IMU_CHANNELS][MPU6050_FIFO_SIZE / 12];
+    int16_t *columns[IMU_CHANNELS];
+    uint64_t times[MPU6050_FIFO_SIZE / 12];
+    uint64_t now;
+
+    Rig(bool temperature = true) : fifo(imu), now(0) {
+        for (size_t ch = 0; ch < IMU_CHANNELS; ch++) columns[ch] = data[ch];
+        fifo.begin(RATE_DIVIDER, DLPF_MODE, 0, temperature);
+    }
+
+    void sample(size_t frames) {
+        imu.sample(frames);
+        now += frames * PERIOD;
+    }
+
+    size_t drain() {
+        size_t n = fifo.drain(columns, 0, MPU6050_FIFO_SIZE);
+        if (n > 0) fifo.frameTimes(now, n, times);
+        return n;
+    }
+};
+
+// Frame i of the last drain is frame number n of the sensor, all its words in the right columns
+static bool isFrame(const Rig &rig, size_t i, uint64_t n, bool temperature = true) {
+    size_t w = 0;
+    for (size_t ch = 0; ch < IMU_CHANNELS; ch++) {
+        if (ch == IMU_TEMP && !temperature) continue;
+        if (rig.data[ch][i] != SimulatedMpu6050::word(n, w++)) return false;
+    }
+    return true;
+}
+
+void test_drain_reads_bursts_of_whole_frames() {
+    static Rig rig;
+    TEST_ASSERT_EQUAL(PERIOD, rig.fifo.samplePeriod());
+    rig.sample(40);
+    TEST_ASSERT_EQUAL(40, rig.fifo.available());
+    TEST_ASSERT_EQUAL(40, rig.drain());
+    for (size_t i = 0; i < 40; i++) {
+        TEST_ASSERT_TRUE(isFrame(rig, i, i));
+        TEST_ASSERT_TRUE(rig.times[i] == rig.now - (39 - i) * PERIOD); // newest frame is from now, spaced by the sensor clock
+    }
+    TEST_ASSERT_EQUAL(3, rig.imu.reads); // 40 frames of 14 bytes: 18 + 18 + 4 per 255-byte burst
+    TEST_ASSERT_EQUAL(3, rig.imu.getFIFOStats().bursts);
+    TEST_ASSERT_EQUAL(0, rig.fifo.statistics().overflows);
+}
+
+// 73 frames are 1022 bytes: as full as the FIFO gets without losing anything, nothing may be discarded
+void test_full_fifo_without_overflow_keeps_everything() {
+    static Rig rig;
+    rig.sample(73);
+    TEST_ASSERT_EQUAL(73, rig.drain());
+    for (size_t i = 0; i < 73; i++) TEST_ASSERT_TRUE(isFrame(rig, i, i));
+    TEST_ASSERT_EQUAL(0, rig.imu.getFIFOStats().overflows);
+    TEST_ASSERT_EQUAL(0, rig.imu.getFIFOStats().droppedPackets);
+    TEST_ASSERT_EQUAL(0, rig.fifo.statistics().droppedFrames);
+}
+
+// 205 frames without a drain: the FIFO keeps the newest 1024 bytes, 73 whole frames behind the last 2 bytes of an older one
+void test_overflow_discards_partial_head_and_realigns() {
+    static Rig rig;
+    rig.sample(5);
+    TEST_ASSERT_EQUAL(5, rig.drain());
+    uint64_t lastTime = rig.times[4];
+
+    rig.sample(200);
+    TEST_ASSERT_TRUE(rig.imu.lostBytes > 0);
+    size_t n = rig.drain();
+    TEST_ASSERT_EQUAL(73, n);
+    for (size_t i = 0; i < n; i++) TEST_ASSERT_TRUE(isFrame(rig, i, 132 + i)); // frames 132..204, aligned
+    TEST_ASSERT_EQUAL(0, rig.drain());
+
+    const MPU6050_FIFOStats &lib = rig.imu.getFIFOStats();
+    TEST_ASSERT_EQUAL(1, lib.overflows);
+    TEST_ASSERT_EQUAL(1, lib.droppedPackets); // the 2-byte tail of frame 131
+    TEST_ASSERT_EQUAL(1, rig.fifo.statistics().overflows);
+
+    // frameTimes() counts frames 5..131 as dropped and keeps the kept ones on the sensor's grid
+    TEST_ASSERT_EQUAL(127, rig.fifo.statistics().droppedFrames);
+    TEST_ASSERT_TRUE(rig.times[0] == lastTime + 128 * PERIOD);
+    TEST_ASSERT_TRUE(rig.times[72] == rig.now);
+
+    // and carries on from there
+    rig.sample(10);
+    TEST_ASSERT_EQUAL(10, rig.drain());
+    TEST_ASSERT_TRUE(isFrame(rig, 0, 205));
+    TEST_ASSERT_TRUE(rig.times[0] == lastTime + 201 * PERIOD);
+    TEST_ASSERT_EQUAL(127, rig.fifo.statistics().droppedFrames);
+    TEST_ASSERT_EQUAL(1, rig.imu.getFIFOStats().overflows);
+}
+
+// Without the temperature a frame is 12 bytes: 85 frames and a 4-byte partial survive, the temperature column stays untouched
+void test_overflow_without_temperature() {
+    static Rig rig(false);
+    for (size_t i = 0; i < MPU6050_FIFO_SIZE / 12; i++) rig.data[IMU_TEMP][i] = -1;
+    rig.sample(300);
+    size_t n = rig.drain();
+    TEST_ASSERT_EQUAL(85, n);
+    for (size_t i = 0; i < n; i++) {
+        TEST_ASSERT_TRUE(isFrame(rig, i, 215 + i, false));
+        TEST_ASSERT_EQUAL(-1, rig.data[IMU_TEMP][i]);
+    }
+    TEST_ASSERT_EQUAL(1, rig.imu.getFIFOStats().droppedPackets);
+    TEST_ASSERT_EQUAL(1, rig.fifo.statistics().overflows);
+}
+
+// The drain is limited to what the caller has room for, the rest stays queued
+void test_drain_leaves_the_rest_queued() {
+    static Rig rig;
+    rig.sample(30);
+    TEST_ASSERT_EQUAL(20, rig.fifo.drain(rig.columns, 0, 20));
+    TEST_ASSERT_EQUAL(10, rig.fifo.available());
+    TEST_ASSERT_EQUAL(10, rig.fifo.drain(rig.columns, 20, 20));
+    for (size_t i = 0; i < 30; i++) TEST_ASSERT_TRUE(isFrame(rig, i, i));
+}
+
+int main(int, char **) {
+    UNITY_BEGIN();
+    RUN_TEST(test_drain_reads_bursts_of_whole_frames);
+    RUN_TEST(test_full_fifo_without_overflow_keeps_everything);
+    RUN_TEST(test_overflow_discards_partial_head_and_realigns);
+    RUN_TEST(test_overflow_without_temperature);
+    RUN_TEST(test_drain_leaves_the_rest_queued);
+    return UNITY_END();
+}
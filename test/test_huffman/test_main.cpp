@@ -0,0 +1,100 @@
+// HuffmanDecoder against the encoder and against code tables that did not come from it: over-full length sets,
+// zero lengths and repeated characters are rejected instead of overrunning the lookup table.
+// pio test -e native -f test_huffman
+
+#include <unity.h>
+#include "Huffman.h"
+
+void setUp() {}
+void tearDown() {}
+
+// Code table of the encoder for "input", as it goes on the wire
+static void encode(const std::string &input, std::vector<char> &chars, std::vector<uint8_t> &lengths,
+                   std::vector<uint8_t> &bits, size_t &bitCount) {
+    std::array<int, 256> freq{};
+    for (char c : input) freq[(uint8_t)c]++;
+    std::vector<char> used;
+    std::vector<int> counts;
+    for (int c = 0; c < 256; c++) {
+        if (freq[c] == 0) continue;
+        used.push_back((char)c);
+        counts.push_back(freq[c]);
+    }
+    HuffmanTable codes = generateHuffmanCodes(used, counts);
+    chars.clear();
+    lengths.clear();
+    for (char c : used) {
+        chars.push_back(c);
+        lengths.push_back(codes[(uint8_t)c].length);
+    }
+    bits = packHuffmanBits(input, codes, bitCount);
+}
+
+void test_round_trip() {
+    std::string input = "[[-12,4051,16384,-3,7,1],[-11,4049,16380,-2,7,0]]";
+    std::vector<char> chars;
+    std::vector<uint8_t> lengths, bits;
+    size_t bitCount;
+    encode(input, chars, lengths, bits, bitCount);
+    TEST_ASSERT_TRUE(validCodeLengths(chars, lengths));
+
+    HuffmanDecoder decoder(chars, lengths);
+    std::string out;
+    TEST_ASSERT_TRUE(decoder.valid());
+    TEST_ASSERT_TRUE(decoder.decode(bits.data(), bitCount, out));
+    TEST_ASSERT_TRUE(out == input);
+}
+
+void test_single_character() {
+    std::vector<char> chars;
+    std::vector<uint8_t> lengths, bits;
+    size_t bitCount;
+    encode("aaaa", chars, lengths, bits, bitCount);
+    HuffmanDecoder decoder(chars, lengths);
+    std::string out;
+    TEST_ASSERT_TRUE(decoder.decode(bits.data(), bitCount, out));
+    TEST_ASSERT_TRUE(out == "aaaa");
+}
+
+void test_over_full_lengths_are_rejected() {
+    std::vector<char> chars = {'a', 'b', 'c', 'd'};
+    std::vector<uint8_t> lengths = {1, 1, 1, 1}; // Kraft sum 2
+    TEST_ASSERT_FALSE(validCodeLengths(chars, lengths));
+
+    HuffmanDecoder decoder(chars, lengths);
+    uint8_t data[2] = {0xFF, 0xFF};
+    std::string out;
+    TEST_ASSERT_FALSE(decoder.valid());
+    TEST_ASSERT_FALSE(decoder.decode(data, 16, out));
+    TEST_ASSERT_TRUE(out.empty());
+
+    // One code too many at the longest length
+    chars.clear();
+    lengths.clear();
+    for (int c = 0; c < 256; c++) {
+        chars.push_back((char)c);
+        lengths.push_back(8);
+    }
+    TEST_ASSERT_TRUE(validCodeLengths(chars, lengths)); // exactly full
+    lengths[0] = 7;
+    lengths[1] = 7;
+    TEST_ASSERT_FALSE(validCodeLengths(chars, lengths));
+}
+
+void test_bad_entries_are_rejected() {
+    TEST_ASSERT_FALSE(validCodeLengths({'a', 'b'}, {1, 0}));
+    TEST_ASSERT_FALSE(validCodeLengths({'a', 'b'}, {1, HUFFMAN_MAX_CODE_LENGTH + 1}));
+    TEST_ASSERT_FALSE(validCodeLengths({'a', 'a'}, {1, 1}));
+    TEST_ASSERT_FALSE(validCodeLengths({'a', 'b'}, {1}));
+    TEST_ASSERT_TRUE(validCodeLengths({'a', 'b', 'c'}, {1, 2, 2}));
+    TEST_ASSERT_TRUE(validCodeLengths({}, {}));
+}
+
+int main(int, char **) {
+    UNITY_BEGIN();
+    RUN_TEST(test_round_trip);
+    RUN_TEST(test_single_character);
+    RUN_TEST(test_over_full_lengths_are_rejected);
+    RUN_TEST(test_bad_entries_are_rejected);
+    return UNITY_END();
+}
@@ -0,0 +1,210 @@
+// I2cEngine against a fake bus: follow-ups, holds, failures and a full queue. FifoAcquisition::prefetch() against
+// SimulatedMpu6050 as the bus: the held count re-read, the bursts of prefetchNext and the hand-over to drain().
+// pio test -e native -f test_i2c_engine
+
+#include <unity.h>
+#include "FifoAcquisition.h"
+#include "I2cEngine.h"
+#include "SimulatedMpu6050.h"
+
+void setUp() {}
+void tearDown() {}
+
+// Records every transfer and hold in order. Transfers to failAddr fail
+struct FakeBus {
+    struct Transfer {
+        uint8_t devAddr;
+        uint8_t regAddr;
+        uint8_t length;
+        bool write;
+        uint32_t heldBefore; // hold() right before this transfer
+    };
+
+    FakeBus() : count(0), pendingHold(0), failAddr(0xFF) {}
+
+    bool read(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, void *) {
+        for (uint8_t i = 0; i < length; i++) data[i] = (uint8_t)(regAddr + i);
+        return record(devAddr, regAddr, length, false);
+    }
+
+    bool write(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *, void *) {
+        return record(devAddr, regAddr, length, true);
+    }
+
+    void hold(uint32_t micros) { pendingHold += micros; }
+
+    bool record(uint8_t devAddr, uint8_t regAddr, uint8_t length, bool write) {
+        if (count < 16) log[count++] = {devAddr, regAddr, length, write, pendingHold};
+        pendingHold = 0;
+        return devAddr != failAddr;
+    }
+
+    Transfer log[16];
+    size_t count;
+    uint32_t pendingHold;
+    uint8_t failAddr;
+};
+
+static int doneCalls = 0;
+static void countDone(I2cTransaction &) { doneCalls++; }
+
+// Three reads of the same device: regAddr 0x10, 0x20 after holding 500 us, then 0x30
+static bool threeSteps(I2cTransaction &t) {
+    if (t.regAddr == 0x30) return false;
+    uint8_t next = (uint8_t)(t.regAddr + 0x10);
+    t.read(t.devAddr, next, t.data, t.length, t.wireObj);
+    if (next == 0x20) t.holdMicros = 500;
+    return true;
+}
+
+void test_follow_ups_and_holds_run_in_order() {
+    FakeBus bus;
+    I2cEngine<FakeBus, 4> engine(bus);
+    uint8_t data[2];
+    I2cTransaction t;
+    t.read(0x68, 0x10, data, 2);
+    t.next = threeSteps;
+    t.done = countDone;
+    doneCalls = 0;
+
+    TEST_ASSERT_TRUE(engine.submit(t));
+    TEST_ASSERT_EQUAL(I2C_PENDING, t.status());
+    TEST_ASSERT_FALSE(engine.submit(t)); // still pending
+    TEST_ASSERT_TRUE(engine.runOne());
+    TEST_ASSERT_FALSE(engine.runOne());
+
+    TEST_ASSERT_EQUAL(I2C_DONE, t.status());
+    TEST_ASSERT_EQUAL(1, doneCalls);
+    TEST_ASSERT_EQUAL(3, bus.count);
+    TEST_ASSERT_EQUAL(0x10, bus.log[0].regAddr);
+    TEST_ASSERT_EQUAL(0x20, bus.log[1].regAddr);
+    TEST_ASSERT_EQUAL(0x30, bus.log[2].regAddr);
+    TEST_ASSERT_EQUAL(0, bus.log[0].heldBefore);
+    TEST_ASSERT_EQUAL(500, bus.log[1].heldBefore);
+    TEST_ASSERT_EQUAL(0, bus.log[2].heldBefore); // read() clears the hold of the previous step
+    TEST_ASSERT_EQUAL(0x31, data[1]);
+    TEST_ASSERT_EQUAL(1, engine.statistics().submitted);
+    TEST_ASSERT_EQUAL(3, engine.statistics().transfers);
+}
+
+// A failing device ends its own chain, the transactions behind it still run
+void test_failure_stops_the_chain_only() {
+    FakeBus bus;
+    bus.failAddr = 0x55;
+    I2cEngine<FakeBus, 4> engine(bus);
+    uint8_t a[1], b[1];
+    I2cTransaction failing, next;
+    failing.read(0x55, 0x10, a, 1);
+    failing.next = threeSteps;
+    failing.done = countDone;
+    next.writeTo(0x68, 0x6B, b, 1);
+    doneCalls = 0;
+
+    TEST_ASSERT_TRUE(engine.submit(failing));
+    TEST_ASSERT_TRUE(engine.submit(next));
+    TEST_ASSERT_EQUAL(2, engine.pending());
+    TEST_ASSERT_EQUAL(2, engine.runAll());
+
+    TEST_ASSERT_EQUAL(I2C_FAILED, failing.status());
+    TEST_ASSERT_EQUAL(I2C_DONE, next.status());
+    TEST_ASSERT_EQUAL(1, doneCalls); // done() also reports a failure
+    TEST_ASSERT_EQUAL(2, bus.count);  // no follow-up after the failed transfer
+    TEST_ASSERT_TRUE(bus.log[1].write);
+    TEST_ASSERT_EQUAL(1, engine.statistics().failed);
+}
+
+void test_full_queue_rejects() {
+    FakeBus bus;
+    I2cEngine<FakeBus, 4> engine(bus);
+    uint8_t data[1];
+    I2cTransaction t[5];
+    for (size_t i = 0; i < 5; i++) t[i].read(0x68, (uint8_t)i, data, 1);
+    for (size_t i = 0; i < 4; i++) TEST_ASSERT_TRUE(engine.submit(t[i]));
+
+    TEST_ASSERT_FALSE(engine.submit(t[4]));
+    TEST_ASSERT_EQUAL(I2C_FAILED, t[4].status()); // the submitter gets it back right away
+    TEST_ASSERT_EQUAL(1, engine.statistics().rejected);
+    TEST_ASSERT_EQUAL(4, engine.statistics().submitted);
+
+    TEST_ASSERT_EQUAL(4, engine.runAll());
+    for (size_t i = 0; i < 4; i++) TEST_ASSERT_EQUAL(I2C_DONE, t[i].status());
+    TEST_ASSERT_TRUE(engine.submit(t[4])); // room again
+    TEST_ASSERT_EQUAL(1, engine.runAll());
+    TEST_ASSERT_EQUAL(I2C_DONE, t[4].status());
+}
+
+// --- prefetch ---
+
+struct PrefetchRig {
+    SimulatedMpu6050 imu;
+    FifoAcquisition<SimulatedMpu6050> fifo;
+    I2cEngine<SimulatedMpu6050, 4> engine;
+    int16_t data[IMU_CHANNELS][128];
+    int16_t *columns[IMU_CHANNELS];
+
+    PrefetchRig() : fifo(imu), engine(imu) {
+        for (size_t ch = 0; ch < IMU_CHANNELS; ch++) columns[ch] = data[ch];
+        fifo.begin(9, 3); // 100 Hz
+    }
+
+    bool prefetch(size_t minFrames) {
+        return fifo.prefetch([this](I2cTransaction &t) { return engine.submit(t); }, 0x68, minFrames);
+    }
+};
+
+static bool isFrame(const PrefetchRig &rig, size_t i, uint64_t n) {
+    for (size_t ch = 0; ch < IMU_CHANNELS; ch++) {
+        if (rig.data[ch][i] != SimulatedMpu6050::word(n, ch)) return false;
+    }
+    return true;
+}
+
+// 20 frames there, 50 wanted: the count is read again after the 30 missing ones had time to arrive, then 3 bursts
+void test_prefetch_waits_for_frames_and_hands_them_to_drain() {
+    static PrefetchRig rig;
+    rig.imu.sample(20);
+    TEST_ASSERT_TRUE(rig.prefetch(50));
+    TEST_ASSERT_FALSE(rig.prefetch(50)); // one at a time
+    TEST_ASSERT_TRUE(rig.fifo.prefetchPending());
+    TEST_ASSERT_EQUAL(0, rig.fifo.drain(rig.columns, 0, 100)); // not read yet
+
+    TEST_ASSERT_EQUAL(1, rig.engine.runAll());
+    TEST_ASSERT_FALSE(rig.fifo.prefetchPending());
+    TEST_ASSERT_EQUAL(2 + 3, rig.engine.statistics().transfers); // count, held count, 18 + 18 + 14 frames
+    TEST_ASSERT_EQUAL(3, rig.imu.reads);
+
+    TEST_ASSERT_EQUAL(30, rig.fifo.drain(rig.columns, 0, 30)); // buffered frames first, as far as there is room
+    TEST_ASSERT_EQUAL(20, rig.fifo.drain(rig.columns, 30, 30));
+    for (size_t i = 0; i < 50; i++) TEST_ASSERT_TRUE(isFrame(rig, i, i));
+    TEST_ASSERT_EQUAL(50, rig.fifo.statistics().prefetched);
+    TEST_ASSERT_EQUAL(0, rig.imu.getFIFOCount());
+
+    rig.imu.sample(5); // then the FIFO is read directly again
+    TEST_ASSERT_EQUAL(5, rig.fifo.drain(rig.columns, 0, 100));
+    TEST_ASSERT_TRUE(isFrame(rig, 0, 50));
+}
+
+// A FIFO that may have overflowed is not touched by the prefetch, drain() realigns it
+void test_prefetch_leaves_a_full_fifo_to_drain() {
+    static PrefetchRig rig;
+    rig.imu.sample(100);
+    TEST_ASSERT_TRUE(rig.prefetch(10));
+    TEST_ASSERT_EQUAL(1, rig.engine.runAll());
+    TEST_ASSERT_EQUAL(1, rig.engine.statistics().transfers); // the count only
+    TEST_ASSERT_EQUAL(0, rig.imu.reads);
+
+    TEST_ASSERT_EQUAL(73, rig.fifo.drain(rig.columns, 0, 100));
+    TEST_ASSERT_TRUE(isFrame(rig, 0, 27));
+    TEST_ASSERT_EQUAL(0, rig.fifo.statistics().prefetched);
+    TEST_ASSERT_EQUAL(1, rig.fifo.statistics().overflows);
+}
+
+int main(int, char **) {
+    UNITY_BEGIN();
+    RUN_TEST(test_follow_ups_and_holds_run_in_order);
+    RUN_TEST(test_failure_stops_the_chain_only);
+    RUN_TEST(test_full_queue_rejects);
+    RUN_TEST(test_prefetch_waits_for_frames_and_hands_them_to_drain);
+    RUN_TEST(test_prefetch_leaves_a_full_fifo_to_drain);
+    return UNITY_END();
+}
@@ -0,0 +1,155 @@
+// MotionCapture against SimulatedCapturePlatform: watermark and motion wake-ups, the end of a burst after quietMicros,
+// the time per PowerState and the charge it adds up to. PreTriggerBuffer keeping the newest samples.
+// pio test -e native -f test_motion_capture
+
+#include <unity.h>
+#include <vector>
+#include "MotionCapture.h"
+
+void setUp() {}
+void tearDown() {}
+
+static const CaptureConfig CONFIG = {100000, 50000}; // watermark after 100 ms, a burst ends after 50 ms quiet
+static const uint32_t PACKET_MICROS = 20000;
+static const uint32_t CONNECT_MICROS = 30000;
+
+void test_watermark_wakes_keep_the_radio_off() {
+    SimulatedCapturePlatform platform(nullptr, 0, PACKET_MICROS, CONNECT_MICROS);
+    MotionCapture capture(CONFIG);
+    capture.begin(platform.now());
+
+    for (int i = 0; i < 5; i++) {
+        capture.step(platform);
+        TEST_ASSERT_EQUAL(CAPTURE_IDLE, capture.state());
+        TEST_ASSERT_EQUAL(POWER_AWAKE, capture.powerState());
+    }
+
+    const CaptureStats &s = capture.statistics();
+    TEST_ASSERT_EQUAL(5, s.watermarkWakes);
+    TEST_ASSERT_EQUAL(0, s.motionWakes);
+    TEST_ASSERT_EQUAL(0, s.bursts);
+    TEST_ASSERT_EQUAL(5, platform.preTriggerReads);
+    TEST_ASSERT_EQUAL(0, platform.burstStarts);
+    TEST_ASSERT_FALSE(platform.radioIsOn());
+    TEST_ASSERT_EQUAL_UINT64(500000, platform.now());
+    TEST_ASSERT_EQUAL_UINT64(500000, s.micros[POWER_SLEEP]);
+    TEST_ASSERT_EQUAL_UINT64(0, s.micros[POWER_RADIO]);
+}
+
+// Motion from 250 ms to 300 ms: two watermark wakes, a motion wake at 250 ms, radio on until 50 ms passed
+// without motion, then back to sleep
+void test_motion_starts_a_burst_that_ends_after_the_quiet_time() {
+    static const SimulatedCapturePlatform::Interval motion[] = {{250000, 300000}};
+    SimulatedCapturePlatform platform(motion, 1, PACKET_MICROS, CONNECT_MICROS);
+    MotionCapture capture(CONFIG);
+    capture.begin(platform.now());
+
+    capture.step(platform);
+    capture.step(platform);
+    TEST_ASSERT_EQUAL(2, capture.statistics().watermarkWakes);
+    TEST_ASSERT_EQUAL_UINT64(200000, platform.now());
+
+    capture.step(platform); // woken by motion at 250 ms, connecting takes 30 ms
+    TEST_ASSERT_EQUAL(CAPTURE_BURST, capture.state());
+    TEST_ASSERT_EQUAL(POWER_RADIO, capture.powerState());
+    TEST_ASSERT_TRUE(platform.radioIsOn());
+    TEST_ASSERT_EQUAL(1, platform.burstStarts);
+    TEST_ASSERT_EQUAL(3, platform.preTriggerReads);
+    TEST_ASSERT_EQUAL_UINT64(280000, platform.now());
+
+    // packets end at 300 (motion), 320, 340 and 360 ms, the last one is 60 ms after the motion
+    for (int i = 0; i < 3; i++) {
+        capture.step(platform);
+        TEST_ASSERT_EQUAL(CAPTURE_BURST, capture.state());
+    }
+    capture.step(platform);
+    TEST_ASSERT_EQUAL(CAPTURE_IDLE, capture.state());
+    TEST_ASSERT_EQUAL(POWER_AWAKE, capture.powerState());
+    TEST_ASSERT_FALSE(platform.radioIsOn());
+    TEST_ASSERT_EQUAL_UINT64(360000, platform.now());
+
+    capture.step(platform); // back to watermark wakes
+    TEST_ASSERT_EQUAL(CAPTURE_IDLE, capture.state());
+    TEST_ASSERT_EQUAL_UINT64(460000, platform.now());
+    capture.account(470000);
+
+    const CaptureStats &s = capture.statistics();
+    TEST_ASSERT_EQUAL(3, s.watermarkWakes);
+    TEST_ASSERT_EQUAL(1, s.motionWakes);
+    TEST_ASSERT_EQUAL(1, s.bursts);
+    TEST_ASSERT_EQUAL(4, s.packets);
+    TEST_ASSERT_EQUAL(4, platform.packets);
+    TEST_ASSERT_EQUAL_UINT64(350000, s.micros[POWER_SLEEP]);
+    TEST_ASSERT_EQUAL_UINT64(10000, s.micros[POWER_AWAKE]);
+    TEST_ASSERT_EQUAL_UINT64(110000, s.micros[POWER_RADIO]); // connecting and the four packets
+
+    EnergyModel model = {{0.8f, 40.0f, 120.0f}};
+    // 0.8 mA * 0.35 s + 40 mA * 0.01 s + 120 mA * 0.11 s
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 13.88f, captureCharge(s, model));
+}
+
+// Motion that goes on keeps the burst going, a sleep that starts during motion wakes right away
+void test_ongoing_motion_extends_the_burst() {
+    static const SimulatedCapturePlatform::Interval motion[] = {{0, 200000}, {230000, 240000}};
+    SimulatedCapturePlatform platform(motion, 2, PACKET_MICROS, CONNECT_MICROS);
+    MotionCapture capture(CONFIG);
+    capture.begin(platform.now());
+
+    capture.step(platform);
+    TEST_ASSERT_EQUAL(1, capture.statistics().motionWakes);
+    TEST_ASSERT_EQUAL_UINT64(0, capture.statistics().micros[POWER_SLEEP]);
+
+    while (capture.state() == CAPTURE_BURST) capture.step(platform);
+    // packets every 20 ms from 30 ms on, the one ending at 250 ms saw the second interval, the one ending 60 ms later
+    // is the last
+    TEST_ASSERT_EQUAL_UINT64(310000, platform.now());
+    TEST_ASSERT_EQUAL(14, capture.statistics().packets);
+    TEST_ASSERT_EQUAL(1, capture.statistics().bursts);
+    TEST_ASSERT_EQUAL_UINT64(310000, capture.statistics().micros[POWER_RADIO]);
+}
+
+static ImuSample sampleAt(uint64_t timestamp) {
+    ImuSample s = {};
+    s.timestamp = timestamp;
+    s.values[0] = (int16_t)timestamp;
+    return s;
+}
+
+void test_pre_trigger_buffer_keeps_the_newest() {
+    PreTriggerBuffer<4> buffer;
+    std::vector<uint64_t> out;
+    for (uint64_t t = 1; t <= 6; t++) buffer.push(sampleAt(t));
+    TEST_ASSERT_EQUAL(4, buffer.size());
+
+    buffer.consume([&out](const ImuSample &s) { out.push_back(s.timestamp); });
+    std::vector<uint64_t> expected = {3, 4, 5, 6};
+    TEST_ASSERT_TRUE(out == expected);
+    TEST_ASSERT_EQUAL(0, buffer.size());
+
+    // starts over behind the wrapped head
+    out.clear();
+    for (uint64_t t = 7; t <= 13; t++) buffer.push(sampleAt(t));
+    buffer.consume([&out](const ImuSample &s) { out.push_back(s.timestamp); });
+    expected = {10, 11, 12, 13};
+    TEST_ASSERT_TRUE(out == expected);
+
+    out.clear();
+    buffer.push(sampleAt(14));
+    buffer.push(sampleAt(15));
+    buffer.consume([&out](const ImuSample &s) { out.push_back(s.timestamp); });
+    expected = {14, 15};
+    TEST_ASSERT_TRUE(out == expected);
+
+    buffer.push(sampleAt(16));
+    buffer.clear();
+    TEST_ASSERT_EQUAL(0, buffer.size());
+}
+
+int main(int, char **) {
+    UNITY_BEGIN();
+    RUN_TEST(test_watermark_wakes_keep_the_radio_off);
+    RUN_TEST(test_motion_starts_a_burst_that_ends_after_the_quiet_time);
+    RUN_TEST(test_ongoing_motion_extends_the_burst);
+    RUN_TEST(test_pre_trigger_buffer_keeps_the_newest);
+    return UNITY_END();
+}
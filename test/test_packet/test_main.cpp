@@ -0,0 +1,116 @@
+// parsePacket() and decodePacketPayload() on packets from buildPacket() and on malformed ones: code tables the
+// decoder cannot hold and payload sizes that do not match the payload bits are rejected before anything is decoded.
+// pio test -e native -f test_packet
+
+#include <unity.h>
+#include "Packet.h"
+
+void setUp() {}
+void tearDown() {}
+
+static PacketMeta meta() {
+    PacketMeta m{};
+    m.scale.accelRange = 1;
+    m.scale.gyroRange = 2;
+    m.baseMicros = 123456789012ull;
+    m.groups = 1;
+    m.profile = 0;
+    m.periodMicros = 5000;
+    return m;
+}
+
+// Huffman packet for "input" with the encoder's code table
+static std::vector<uint8_t> huffmanPacket(const std::string &input) {
+    std::array<int, 256> freq{};
+    for (char c : input) freq[(uint8_t)c]++;
+    std::vector<char> chars;
+    std::vector<int> counts;
+    for (int c = 0; c < 256; c++) {
+        if (freq[c] == 0) continue;
+        chars.push_back((char)c);
+        counts.push_back(freq[c]);
+    }
+    HuffmanTable codes = generateHuffmanCodes(chars, counts);
+    std::vector<uint8_t> lengths;
+    for (char c : chars) lengths.push_back(codes[(uint8_t)c].length);
+    size_t bitCount;
+    std::vector<uint8_t> bits = packHuffmanBits(input, codes, bitCount);
+    return buildPacket(PACKET_CODEC_HUFFMAN, meta(), (uint32_t)input.size() * 8, (uint32_t)bitCount, chars, lengths,
+                       bits.data(), bits.size());
+}
+
+void test_huffman_round_trip() {
+    std::string input = "[[0,-12,4051,16384],[5000,-11,4049,16380]]";
+    std::vector<uint8_t> packet = huffmanPacket(input);
+    PacketView view;
+    std::string out;
+    TEST_ASSERT_TRUE(parsePacket(packet.data(), packet.size(), view));
+    TEST_ASSERT_EQUAL(PACKET_CODEC_HUFFMAN, view.codec);
+    TEST_ASSERT_EQUAL_UINT64(123456789012ull, view.meta.baseMicros);
+    TEST_ASSERT_EQUAL(5000, view.meta.periodMicros);
+    TEST_ASSERT_TRUE(decodePacketPayload(view, out));
+    TEST_ASSERT_TRUE(out == input);
+}
+
+void test_plain_round_trip() {
+    std::vector<uint8_t> packet = buildPacket(PACKET_CODEC_RLE, meta(), 80, std::string("0,3x1,2"));
+    PacketView view;
+    std::string out;
+    TEST_ASSERT_TRUE(parsePacket(packet.data(), packet.size(), view));
+    TEST_ASSERT_TRUE(decodePacketPayload(view, out));
+    TEST_ASSERT_TRUE(out == "0,3x1,2");
+}
+
+// Four codes of length 1: canonicalCodes() would number them past 2^15
+void test_over_full_code_table_is_rejected() {
+    std::vector<char> chars = {'a', 'b', 'c', 'd'};
+    std::vector<uint8_t> lengths = {1, 1, 1, 1};
+    uint8_t payload[2] = {0xFF, 0xFF};
+    std::vector<uint8_t> packet = buildPacket(PACKET_CODEC_HUFFMAN, meta(), 64, 16, chars, lengths, payload, 2);
+    PacketView view;
+    TEST_ASSERT_FALSE(parsePacket(packet.data(), packet.size(), view));
+}
+
+void test_bad_code_table_entries_are_rejected() {
+    uint8_t payload[1] = {0x80};
+    PacketView view;
+
+    std::vector<uint8_t> zero = buildPacket(PACKET_CODEC_HUFFMAN, meta(), 8, 1, {'a', 'b'}, {1, 0}, payload, 1);
+    TEST_ASSERT_FALSE(parsePacket(zero.data(), zero.size(), view));
+
+    std::vector<uint8_t> repeated = buildPacket(PACKET_CODEC_HUFFMAN, meta(), 8, 1, {'a', 'a'}, {1, 1}, payload, 1);
+    TEST_ASSERT_FALSE(parsePacket(repeated.data(), repeated.size(), view));
+
+    std::vector<uint8_t> tooLong = buildPacket(PACKET_CODEC_HUFFMAN, meta(), 8, 1, {'a', 'b'},
+                                               {1, HUFFMAN_MAX_CODE_LENGTH + 1}, payload, 1);
+    TEST_ASSERT_FALSE(parsePacket(tooLong.data(), tooLong.size(), view));
+}
+
+// 0xFFFFFFFF payload bits wrap to 0 bytes in 32 bits and would let the decoder read past an empty payload
+void test_payload_bits_do_not_wrap() {
+    std::vector<uint8_t> packet = buildPacket(PACKET_CODEC_HUFFMAN, meta(), 8, 0xFFFFFFFFu, {'a', 'b'}, {1, 1},
+                                              nullptr, 0);
+    PacketView view;
+    TEST_ASSERT_FALSE(parsePacket(packet.data(), packet.size(), view));
+
+    packet = buildPacket(PACKET_CODEC_HUFFMAN, meta(), 8, 9, {'a', 'b'}, {1, 1}, nullptr, 0);
+    TEST_ASSERT_FALSE(parsePacket(packet.data(), packet.size(), view));
+}
+
+void test_truncated_packets_are_rejected() {
+    std::vector<uint8_t> packet = huffmanPacket("[[1,2,3],[4,5,6]]");
+    PacketView view;
+    for (size_t size = 0; size < packet.size(); size++) TEST_ASSERT_FALSE(parsePacket(packet.data(), size, view));
+    TEST_ASSERT_TRUE(parsePacket(packet.data(), packet.size(), view));
+}
+
+int main(int, char **) {
+    UNITY_BEGIN();
+    RUN_TEST(test_huffman_round_trip);
+    RUN_TEST(test_plain_round_trip);
+    RUN_TEST(test_over_full_code_table_is_rejected);
+    RUN_TEST(test_bad_code_table_entries_are_rejected);
+    RUN_TEST(test_payload_bits_do_not_wrap);
+    RUN_TEST(test_truncated_packets_are_rejected);
+    return UNITY_END();
+}
@@ -0,0 +1,199 @@
+// PacketQueue drop policies and close(), SenderWorker draining the queue into a mock sink and its metrics.
+// pio test -e native -f test_packet_queue
+
+#include <unity.h>
+#include <atomic>
+#include <thread>
+#include "PacketQueue.h"
+
+void setUp() {}
+void tearDown() {}
+
+// Remembers the first body byte of every packet it is given, fails the ones listed in failIds
+class MockSink : public PacketSink {
+public:
+    MockSink() : failIds(), delayMs(0) {}
+
+    bool send(const OutgoingPacket &packet) override {
+        if (delayMs > 0) std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
+        uint8_t id = packet.body.empty() ? 0 : packet.body[0];
+        sent.push_back(id);
+        for (uint8_t f : failIds) {
+            if (f == id) return false;
+        }
+        return true;
+    }
+
+    std::vector<uint8_t> sent;
+    std::vector<uint8_t> failIds;
+    uint32_t delayMs;
+};
+
+static OutgoingPacket packet(uint8_t id) {
+    OutgoingPacket p;
+    p.contentType = "application/octet-stream";
+    p.body.assign(4, id);
+    return p;
+}
+
+// Ids of the packets left in the queue, in order
+static std::vector<uint8_t> drainIds(PacketQueue &queue) {
+    std::vector<uint8_t> ids;
+    OutgoingPacket p;
+    while (queue.pop(p, 0)) ids.push_back(p.body[0]);
+    return ids;
+}
+
+void test_drop_oldest_keeps_the_newest() {
+    PacketQueue queue(3, PACKET_DROP_OLDEST);
+    for (uint8_t i = 1; i <= 3; i++) TEST_ASSERT_TRUE(queue.push(packet(i)));
+    TEST_ASSERT_FALSE(queue.push(packet(4)));
+    TEST_ASSERT_FALSE(queue.push(packet(5)));
+
+    SenderMetrics m = queue.snapshot();
+    TEST_ASSERT_EQUAL(3, m.depth);
+    TEST_ASSERT_EQUAL(3, m.highWater);
+    TEST_ASSERT_EQUAL(5, m.enqueued);
+    TEST_ASSERT_EQUAL(2, m.dropped);
+    std::vector<uint8_t> expected = {3, 4, 5};
+    TEST_ASSERT_TRUE(drainIds(queue) == expected);
+}
+
+void test_drop_newest_keeps_the_oldest() {
+    PacketQueue queue(3, PACKET_DROP_NEWEST);
+    for (uint8_t i = 1; i <= 3; i++) TEST_ASSERT_TRUE(queue.push(packet(i)));
+    TEST_ASSERT_FALSE(queue.push(packet(4)));
+
+    SenderMetrics m = queue.snapshot();
+    TEST_ASSERT_EQUAL(3, m.enqueued);
+    TEST_ASSERT_EQUAL(1, m.dropped);
+    std::vector<uint8_t> expected = {1, 2, 3};
+    TEST_ASSERT_TRUE(drainIds(queue) == expected);
+}
+
+void test_block_times_out_and_drops_the_new_packet() {
+    PacketQueue queue(1, PACKET_BLOCK);
+    TEST_ASSERT_TRUE(queue.push(packet(1)));
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    TEST_ASSERT_FALSE(queue.push(packet(2), 20));
+    TEST_ASSERT_TRUE(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(20));
+
+    TEST_ASSERT_EQUAL(1, queue.snapshot().dropped);
+    std::vector<uint8_t> expected = {1};
+    TEST_ASSERT_TRUE(drainIds(queue) == expected);
+}
+
+void test_block_waits_for_the_sender() {
+    PacketQueue queue(1, PACKET_BLOCK);
+    TEST_ASSERT_TRUE(queue.push(packet(1)));
+    std::atomic<bool> pushed(false);
+    std::thread producer([&] { pushed = queue.push(packet(2), 5000); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    TEST_ASSERT_FALSE(pushed.load());
+    OutgoingPacket p;
+    TEST_ASSERT_TRUE(queue.pop(p, 100));
+    TEST_ASSERT_EQUAL(1, p.body[0]);
+    producer.join();
+
+    TEST_ASSERT_TRUE(pushed.load());
+    TEST_ASSERT_EQUAL(0, queue.snapshot().dropped);
+    std::vector<uint8_t> expected = {2};
+    TEST_ASSERT_TRUE(drainIds(queue) == expected);
+}
+
+void test_zero_capacity_drops_every_packet() {
+    for (DropPolicy policy : {PACKET_DROP_OLDEST, PACKET_DROP_NEWEST, PACKET_BLOCK}) {
+        PacketQueue queue(0, policy);
+        TEST_ASSERT_FALSE(queue.push(packet(1), 1));
+        SenderMetrics m = queue.snapshot();
+        TEST_ASSERT_EQUAL(0, m.depth);
+        TEST_ASSERT_EQUAL(0, m.enqueued);
+        TEST_ASSERT_EQUAL(1, m.dropped);
+    }
+}
+
+void test_close_wakes_waiters_and_keeps_the_backlog() {
+    PacketQueue queue(1, PACKET_BLOCK);
+    TEST_ASSERT_TRUE(queue.push(packet(1)));
+    std::atomic<bool> pushed(true);
+    std::thread producer([&] { pushed = queue.push(packet(2), 5000); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    queue.close();
+    producer.join();
+
+    TEST_ASSERT_FALSE(pushed.load());
+    TEST_ASSERT_TRUE(queue.isClosed());
+    TEST_ASSERT_FALSE(queue.push(packet(3)));
+    TEST_ASSERT_EQUAL(2, queue.snapshot().dropped);
+
+    // what was queued before close() still comes out, then pop() returns right away
+    OutgoingPacket p;
+    TEST_ASSERT_TRUE(queue.pop(p, 0));
+    TEST_ASSERT_EQUAL(1, p.body[0]);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    TEST_ASSERT_FALSE(queue.pop(p, 5000));
+    TEST_ASSERT_TRUE(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(1000));
+}
+
+void test_worker_drains_into_the_sink() {
+    PacketQueue queue(8, PACKET_DROP_OLDEST);
+    MockSink sink;
+    sink.failIds = {3};
+    sink.delayMs = 2;
+    SenderWorker worker(queue, sink);
+
+    TEST_ASSERT_FALSE(worker.runOnce(0)); // nothing queued
+    for (uint8_t i = 1; i <= 5; i++) TEST_ASSERT_TRUE(queue.push(packet(i)));
+    TEST_ASSERT_TRUE(worker.runOnce(0));
+    TEST_ASSERT_EQUAL(4, queue.snapshot().depth);
+
+    queue.close();
+    worker.run(); // returns once the queue is closed and empty
+
+    std::vector<uint8_t> expected = {1, 2, 3, 4, 5};
+    TEST_ASSERT_TRUE(sink.sent == expected);
+    SenderMetrics m = queue.snapshot();
+    TEST_ASSERT_EQUAL(0, m.depth);
+    TEST_ASSERT_EQUAL(5, m.highWater);
+    TEST_ASSERT_EQUAL(5, m.enqueued);
+    TEST_ASSERT_EQUAL(0, m.dropped);
+    TEST_ASSERT_EQUAL(4, m.sent);
+    TEST_ASSERT_EQUAL(1, m.failed);
+    TEST_ASSERT_TRUE(m.lastSendMicros >= 2000);
+    TEST_ASSERT_TRUE(m.maxSendMicros >= m.lastSendMicros);
+    TEST_ASSERT_TRUE(m.totalSendMicros >= 5 * 2000);
+    TEST_ASSERT_TRUE(m.totalSendMicros <= 5ull * m.maxSendMicros);
+}
+
+// Sender task and producer on their own threads, as on the device
+void test_worker_thread_sends_everything_in_order() {
+    PacketQueue queue(4, PACKET_BLOCK);
+    MockSink sink;
+    SenderWorker worker(queue, sink);
+    std::thread sender([&] { worker.run(); });
+
+    for (int i = 0; i < 200; i++) TEST_ASSERT_TRUE(queue.push(packet((uint8_t)i), 5000));
+    queue.close();
+    sender.join();
+
+    TEST_ASSERT_EQUAL(200, sink.sent.size());
+    for (size_t i = 0; i < sink.sent.size(); i++) TEST_ASSERT_EQUAL((uint8_t)i, sink.sent[i]);
+    SenderMetrics m = queue.snapshot();
+    TEST_ASSERT_EQUAL(200, m.sent);
+    TEST_ASSERT_EQUAL(0, m.dropped);
+    TEST_ASSERT_LESS_OR_EQUAL(4, m.highWater);
+}
+
+int main(int, char **) {
+    UNITY_BEGIN();
+    RUN_TEST(test_drop_oldest_keeps_the_newest);
+    RUN_TEST(test_drop_newest_keeps_the_oldest);
+    RUN_TEST(test_block_times_out_and_drops_the_new_packet);
+    RUN_TEST(test_block_waits_for_the_sender);
+    RUN_TEST(test_zero_capacity_drops_every_packet);
+    RUN_TEST(test_close_wakes_waiters_and_keeps_the_backlog);
+    RUN_TEST(test_worker_drains_into_the_sink);
+    RUN_TEST(test_worker_thread_sends_everything_in_order);
+    return UNITY_END();
+}
@@ -0,0 +1,181 @@
+// The batched Q30 kernels of helper_3dmath.h against the float Quaternion / VectorFloat classes and the
+// dmpGetGravity() / dmpGetLinearAccel() formulas, on 2000 random quaternions. Some are scaled to |q|^2 between
+// 0.28 and 1.97 to give q30Normalize() something to do.
+// pio test -e native -f test_q30_math
+
+#include <unity.h>
+#include <math.h> // helper_3dmath.h calls sqrt() and expects it declared, as Arduino.h does
+#include <random>
+#include <vector>
+#include "helper_3dmath.h"
+
+void setUp() {}
+void tearDown() {}
+
+static const size_t N = 2000;
+static const int32_t ONE_G = 8192; // MotionApps20
+
+struct Block {
+    std::vector<int32_t> qw, qx, qy, qz;
+    std::vector<Quaternion> unit; // the same quaternions, normalized, as floats
+    std::vector<float> squared;   // |q|^2 before normalizing
+};
+
+// Random unit quaternions in Q30, every third one scaled away from unit length
+static Block randomQuaternions(uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::normal_distribution<double> normal(0.0, 1.0);
+    std::uniform_real_distribution<double> scale2(0.28, 1.97);
+    Block b;
+    for (size_t i = 0; i < N; i++) {
+        double q[4], length = 0;
+        for (int c = 0; c < 4; c++) {
+            q[c] = normal(rng);
+            length += q[c] * q[c];
+        }
+        length = sqrt(length);
+        double s = i % 3 == 0 ? sqrt(scale2(rng)) : 1.0;
+        b.qw.push_back((int32_t)lround(q[0] / length * s * Q30_ONE));
+        b.qx.push_back((int32_t)lround(q[1] / length * s * Q30_ONE));
+        b.qy.push_back((int32_t)lround(q[2] / length * s * Q30_ONE));
+        b.qz.push_back((int32_t)lround(q[3] / length * s * Q30_ONE));
+        b.unit.push_back(Quaternion(b.qw[i] / (float)Q30_ONE, b.qx[i] / (float)Q30_ONE, b.qy[i] / (float)Q30_ONE,
+                                    b.qz[i] / (float)Q30_ONE).getNormalized());
+        b.squared.push_back((float)(s * s));
+    }
+    return b;
+}
+
+static double q30ToDouble(int32_t v) { return v / (double)Q30_ONE; }
+
+void test_normalize_matches_the_float_quaternion() {
+    Block b = randomQuaternions(50);
+    q30Normalize(b.qw.data(), b.qx.data(), b.qy.data(), b.qz.data(), N);
+
+    double worst = 0;
+    for (size_t i = 0; i < N; i++) {
+        const Quaternion &q = b.unit[i];
+        worst = fmax(worst, fabs(q30ToDouble(b.qw[i]) - q.w));
+        worst = fmax(worst, fabs(q30ToDouble(b.qx[i]) - q.x));
+        worst = fmax(worst, fabs(q30ToDouble(b.qy[i]) - q.y));
+        worst = fmax(worst, fabs(q30ToDouble(b.qz[i]) - q.z));
+    }
+    char message[64];
+    snprintf(message, sizeof(message), "normalize: largest error %.2e", worst);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_TRUE(worst < 2e-7);
+}
+
+void test_normalize_leaves_far_off_quaternions_alone() {
+    int32_t qw[2] = {Q30_ONE / 4, Q30_ONE}, qx[2] = {0, Q30_ONE}, qy[2] = {0, 0}, qz[2] = {0, 0}; // |q|^2 1/16 and 2.0
+    q30Normalize(qw, qx, qy, qz, 1);
+    TEST_ASSERT_EQUAL_INT32(Q30_ONE / 4, qw[0]);
+
+    q30Normalize(qw + 1, qx + 1, qy + 1, qz + 1, 1); // the upper end is still taken
+    TEST_ASSERT_INT_WITHIN(2, 759250125, qw[1]); // 2^30 / sqrt(2)
+    TEST_ASSERT_INT_WITHIN(2, 759250125, qx[1]);
+}
+
+void test_gravity_matches_dmp_get_gravity() {
+    Block b = randomQuaternions(51);
+    q30Normalize(b.qw.data(), b.qx.data(), b.qy.data(), b.qz.data(), N);
+    std::vector<int32_t> gx(N), gy(N), gz(N);
+    q30Gravity(b.qw.data(), b.qx.data(), b.qy.data(), b.qz.data(), N, gx.data(), gy.data(), gz.data());
+
+    double worst = 0;
+    for (size_t i = 0; i < N; i++) {
+        const Quaternion &q = b.unit[i];
+        VectorFloat g(2 * (q.x * q.z - q.w * q.y), 2 * (q.w * q.x + q.y * q.z),
+                      q.w * q.w - q.x * q.x - q.y * q.y + q.z * q.z);
+        worst = fmax(worst, fabs(q30ToDouble(gx[i]) - g.x));
+        worst = fmax(worst, fabs(q30ToDouble(gy[i]) - g.y));
+        worst = fmax(worst, fabs(q30ToDouble(gz[i]) - g.z));
+    }
+    char message[64];
+    snprintf(message, sizeof(message), "gravity: largest error %.2e", worst);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_TRUE(worst < 3e-7);
+}
+
+// Raw accelerations up to +-2g, linear acceleration in the world frame as dmpGetLinearAccel() followed by
+// dmpGetLinearAccelInWorld(), with VectorFloat so the reference is not rounded to int16 on the way
+void test_linear_accel_in_world_within_two_counts() {
+    Block b = randomQuaternions(52);
+    q30Normalize(b.qw.data(), b.qx.data(), b.qy.data(), b.qz.data(), N);
+    std::mt19937 rng(53);
+    std::uniform_int_distribution<int32_t> raw(-2 * ONE_G, 2 * ONE_G);
+    std::vector<int32_t> ax(N), ay(N), az(N);
+    for (size_t i = 0; i < N; i++) {
+        ax[i] = raw(rng);
+        ay[i] = raw(rng);
+        az[i] = raw(rng);
+    }
+    std::vector<int32_t> wx = ax, wy = ay, wz = az;
+    q30LinearAccelInWorld(b.qw.data(), b.qx.data(), b.qy.data(), b.qz.data(), wx.data(), wy.data(), wz.data(), N,
+                          ONE_G);
+
+    double worst = 0;
+    for (size_t i = 0; i < N; i++) {
+        Quaternion q = b.unit[i];
+        VectorFloat g(2 * (q.x * q.z - q.w * q.y), 2 * (q.w * q.x + q.y * q.z),
+                      q.w * q.w - q.x * q.x - q.y * q.y + q.z * q.z);
+        VectorFloat v(ax[i] - g.x * ONE_G, ay[i] - g.y * ONE_G, az[i] - g.z * ONE_G);
+        v.rotate(&q);
+        worst = fmax(worst, fabs(wx[i] - v.x));
+        worst = fmax(worst, fabs(wy[i] - v.y));
+        worst = fmax(worst, fabs(wz[i] - v.z));
+    }
+    char message[64];
+    snprintf(message, sizeof(message), "linear accel in world: largest error %.2f counts", worst);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_TRUE(worst <= 2.0);
+}
+
+// q30Rotate() against VectorInt16::rotate(), which truncates to int16 at the end
+void test_rotate_matches_vector_int16() {
+    Block b = randomQuaternions(54);
+    q30Normalize(b.qw.data(), b.qx.data(), b.qy.data(), b.qz.data(), N);
+    std::mt19937 rng(55);
+    std::uniform_int_distribution<int32_t> raw(-16000, 16000);
+    std::vector<int32_t> vx(N), vy(N), vz(N);
+    for (size_t i = 0; i < N; i++) {
+        vx[i] = raw(rng);
+        vy[i] = raw(rng);
+        vz[i] = raw(rng);
+    }
+    std::vector<int32_t> rx = vx, ry = vy, rz = vz;
+    q30Rotate(b.qw.data(), b.qx.data(), b.qy.data(), b.qz.data(), rx.data(), ry.data(), rz.data(), N);
+
+    int worst = 0;
+    for (size_t i = 0; i < N; i++) {
+        Quaternion q = b.unit[i];
+        VectorInt16 v((int16_t)vx[i], (int16_t)vy[i], (int16_t)vz[i]);
+        v.rotate(&q);
+        worst = std::max(worst, abs(rx[i] - v.x));
+        worst = std::max(worst, abs(ry[i] - v.y));
+        worst = std::max(worst, abs(rz[i] - v.z));
+    }
+    TEST_ASSERT_LESS_OR_EQUAL(2, worst);
+}
+
+// The largest components the 64-bit products hold: a quarter turn about z is exact
+void test_rotate_at_the_range_limit() {
+    const int32_t big = 1 << 20;
+    int32_t qw = 759250125, qx = 0, qy = 0, qz = 759250125; // 90 degrees about z
+    int32_t vx = big, vy = -big, vz = -big;
+    q30Rotate(&qw, &qx, &qy, &qz, &vx, &vy, &vz, 1);
+    TEST_ASSERT_INT_WITHIN(1, big, vx);
+    TEST_ASSERT_INT_WITHIN(1, big, vy);
+    TEST_ASSERT_EQUAL_INT32(-big, vz);
+}
+
+int main(int, char **) {
+    UNITY_BEGIN();
+    RUN_TEST(test_normalize_matches_the_float_quaternion);
+    RUN_TEST(test_normalize_leaves_far_off_quaternions_alone);
+    RUN_TEST(test_gravity_matches_dmp_get_gravity);
+    RUN_TEST(test_linear_accel_in_world_within_two_counts);
+    RUN_TEST(test_rotate_matches_vector_int16);
+    RUN_TEST(test_rotate_at_the_range_limit);
+    return UNITY_END();
+}
@@ -0,0 +1,219 @@
+// DmpBlock::drain() against a fake DMP FIFO, and the lossless round trip of encodeDmpStream() / decodeDmpStream():
+// extreme values, truncated and malformed streams, the 16-bit sample count.
+// pio test -e native -f test_quaternion_codec
+
+#include <unity.h>
+#include <random>
+#include <vector>
+#include "QuaternionCodec.h"
+
+void setUp() {}
+void tearDown() {}
+
+// DMP FIFO holding "queued" packets of 28 bytes (the MotionApps 6.12 size). Packet k carries the quaternion
+// k * 1000 + i, the accel k + 10 + i and the gyro -k - i, big endian like the DMP
+struct FakeDmp {
+    static const uint16_t PACKET_SIZE = 28;
+
+    FakeDmp(size_t queued) : queued(queued), next(0), calls(0) {}
+
+    uint16_t dmpGetFIFOPacketSize() { return PACKET_SIZE; }
+
+    uint16_t dmpGetFIFOPackets(uint8_t *data, uint16_t maxPackets) {
+        calls++;
+        uint16_t n = 0;
+        while (n < maxPackets && queued > 0 && (n + 1) * PACKET_SIZE <= 255) {
+            uint8_t *p = data + n * PACKET_SIZE;
+            for (int i = 0; i < 4; i++) put32(p + 4 * i, quat(next, i));
+            for (int i = 0; i < 3; i++) put16(p + 16 + 2 * i, accel(next, i));
+            for (int i = 0; i < 3; i++) put16(p + 22 + 2 * i, gyro(next, i));
+            next++;
+            queued--;
+            n++;
+        }
+        return n;
+    }
+
+    uint8_t dmpGetQuaternion(int32_t *q, const uint8_t *p) {
+        for (int i = 0; i < 4; i++) q[i] = (int32_t)((uint32_t)p[4 * i] << 24 | (uint32_t)p[4 * i + 1] << 16 |
+                                                     (uint32_t)p[4 * i + 2] << 8 | p[4 * i + 3]);
+        return 0;
+    }
+
+    uint8_t dmpGetAccel(int16_t *a, const uint8_t *p) {
+        for (int i = 0; i < 3; i++) a[i] = (int16_t)(p[16 + 2 * i] << 8 | p[17 + 2 * i]);
+        return 0;
+    }
+
+    uint8_t dmpGetGyro(int16_t *g, const uint8_t *p) {
+        for (int i = 0; i < 3; i++) g[i] = (int16_t)(p[22 + 2 * i] << 8 | p[23 + 2 * i]);
+        return 0;
+    }
+
+    static int32_t quat(size_t k, int i) { return (int32_t)(k * 1000 + i); }
+    static int16_t accel(size_t k, int i) { return (int16_t)(k + 10 + i); }
+    static int16_t gyro(size_t k, int i) { return (int16_t)(-(int)k - i); }
+
+    static void put32(uint8_t *p, int32_t v) {
+        for (int b = 0; b < 4; b++) p[b] = (uint8_t)((uint32_t)v >> (24 - 8 * b));
+    }
+    static void put16(uint8_t *p, int16_t v) {
+        p[0] = (uint8_t)((uint16_t)v >> 8);
+        p[1] = (uint8_t)v;
+    }
+
+    size_t queued;
+    size_t next;
+    uint32_t calls;
+};
+
+// Checks samples first..first+n of the fake in a block
+template<size_t N>
+static bool holdsPackets(const DmpBlock<N> &block, size_t first, size_t n) {
+    if (block.size() != n) return false;
+    for (size_t s = 0; s < n; s++) {
+        for (int i = 0; i < 4; i++) {
+            if (block.column(DMP_QW + i)[s] != FakeDmp::quat(first + s, i)) return false;
+        }
+        for (int i = 0; i < 3; i++) {
+            if (block.column(DMP_AX + i)[s] != FakeDmp::accel(first + s, i)) return false;
+            if (block.column(DMP_GX + i)[s] != FakeDmp::gyro(first + s, i)) return false;
+        }
+    }
+    return true;
+}
+
+// 9 packets of 28 bytes per 255-byte burst: 22 full bursts and one of 2 fill 200 samples, the rest stays queued
+void test_drain_fills_the_block_in_bursts() {
+    FakeDmp dmp(250);
+    static DmpBlock<200> block;
+    block.clear();
+
+    TEST_ASSERT_EQUAL(200, block.drain(dmp));
+    TEST_ASSERT_EQUAL(23, dmp.calls);
+    TEST_ASSERT_EQUAL(50, dmp.queued);
+    TEST_ASSERT_TRUE(block.full());
+    TEST_ASSERT_TRUE(holdsPackets(block, 0, 200));
+    TEST_ASSERT_EQUAL(0, block.drain(dmp)); // full, the FIFO is not touched
+    TEST_ASSERT_EQUAL(23, dmp.calls);
+
+    // the rest: 5 full bursts, the sixth comes back short and ends the drain
+    block.clear();
+    dmp.calls = 0;
+    TEST_ASSERT_EQUAL(50, block.drain(dmp));
+    TEST_ASSERT_EQUAL(6, dmp.calls);
+    TEST_ASSERT_EQUAL(0, dmp.queued);
+    TEST_ASSERT_TRUE(holdsPackets(block, 200, 50));
+}
+
+// Columns of n samples and the pointer arrays encode / decode take
+struct Columns {
+    Columns(size_t n) : values(DMP_CHANNELS, std::vector<int32_t>(n)) {
+        for (size_t ch = 0; ch < DMP_CHANNELS; ch++) {
+            in[ch] = values[ch].data();
+            out[ch] = nullptr;
+        }
+    }
+    std::vector<std::vector<int32_t>> values;
+    const int32_t *in[DMP_CHANNELS];
+    int32_t *out[DMP_CHANNELS];
+};
+
+// Encode, decode into fresh columns and compare
+static bool roundTrip(Columns &c, size_t n, size_t *length = nullptr) {
+    std::vector<uint8_t> stream(dmpStreamMaxLength(n));
+    size_t written = encodeDmpStream(c.in, n, stream.data());
+    if (length) *length = written;
+    if (written == 0 || written > stream.size()) return false;
+
+    std::vector<std::vector<int32_t>> decoded(DMP_CHANNELS, std::vector<int32_t>(n + 1, 0x5A5A5A5A));
+    for (size_t ch = 0; ch < DMP_CHANNELS; ch++) c.out[ch] = decoded[ch].data();
+    if (decodeDmpStream(stream.data(), written, c.out, n) != (long)n) return false;
+    for (size_t ch = 0; ch < DMP_CHANNELS; ch++) {
+        for (size_t i = 0; i < n; i++) {
+            if (decoded[ch][i] != c.values[ch][i]) return false;
+        }
+        if (decoded[ch][n] != 0x5A5A5A5A) return false; // nothing written past n
+    }
+    return true;
+}
+
+void test_round_trip_is_exact_for_any_int32() {
+    const size_t n = 257;
+    Columns c(n);
+    std::mt19937 rng(41);
+    for (size_t ch = 0; ch < DMP_CHANNELS; ch++) {
+        for (size_t i = 0; i < n; i++) c.values[ch][i] = (int32_t)rng();
+    }
+    // the largest steps there are
+    for (size_t i = 0; i < 16; i++) c.values[DMP_QW][i] = i % 2 ? INT32_MAX : INT32_MIN;
+    for (size_t i = 0; i < 16; i++) c.values[DMP_QX][i] = i % 2 ? INT32_MIN : INT32_MAX;
+    c.values[DMP_QY][0] = INT32_MIN;
+    c.values[DMP_QZ][n - 1] = INT32_MAX;
+
+    size_t length;
+    TEST_ASSERT_TRUE(roundTrip(c, n, &length));
+    TEST_ASSERT_EQUAL(dmpStreamMaxLength(n), length);
+}
+
+// A slowly turning quaternion takes a few bits per delta, constant columns none
+void test_smooth_columns_pack_tightly() {
+    const size_t n = 200;
+    Columns c(n);
+    for (size_t i = 0; i < n; i++) {
+        c.values[DMP_QW][i] = (1 << 30) - (int32_t)(i * 3);
+        c.values[DMP_QX][i] = (int32_t)(i * 300) - 20000;
+        c.values[DMP_AZ][i] = 16384 + (int32_t)(i % 5) - 2;
+    }
+    size_t length;
+    TEST_ASSERT_TRUE(roundTrip(c, n, &length));
+    // QW: the first delta of 2^30 sets the width to 32 bits, QX: 16 bits (first delta -20000), AZ: 15 bits (16382),
+    // the rest: width 0
+    TEST_ASSERT_EQUAL(2 + DMP_CHANNELS + (32 * n + 16 * n + 15 * n) / 8, length);
+
+    TEST_ASSERT_TRUE(roundTrip(c, 0, &length));
+    TEST_ASSERT_EQUAL(2 + DMP_CHANNELS, length);
+}
+
+void test_truncated_and_malformed_streams_are_rejected() {
+    const size_t n = 50;
+    Columns c(n);
+    for (size_t ch = 0; ch < DMP_CHANNELS; ch++) {
+        for (size_t i = 0; i < n; i++) c.values[ch][i] = (int32_t)(ch * 1000 + i * i);
+    }
+    std::vector<uint8_t> stream(dmpStreamMaxLength(n));
+    size_t length = encodeDmpStream(c.in, n, stream.data());
+    std::vector<std::vector<int32_t>> decoded(DMP_CHANNELS, std::vector<int32_t>(n));
+    for (size_t ch = 0; ch < DMP_CHANNELS; ch++) c.out[ch] = decoded[ch].data();
+
+    for (size_t size = 0; size < length; size++) TEST_ASSERT_EQUAL(-1, decodeDmpStream(stream.data(), size, c.out, n));
+    TEST_ASSERT_EQUAL(n, decodeDmpStream(stream.data(), length, c.out, n));
+    TEST_ASSERT_EQUAL(-1, decodeDmpStream(stream.data(), length, c.out, n - 1)); // more than the columns hold
+
+    stream[2] = 33; // width of the first column
+    TEST_ASSERT_EQUAL(-1, decodeDmpStream(stream.data(), length, c.out, n));
+}
+
+void test_sample_count_limit() {
+    const size_t n = DMP_STREAM_MAX_SAMPLES;
+    Columns c(n);
+    for (size_t ch = 0; ch < DMP_CHANNELS; ch++) {
+        for (size_t i = 0; i < n; i++) c.values[ch][i] = (int32_t)(i * (ch + 1));
+    }
+    TEST_ASSERT_TRUE(roundTrip(c, n));
+
+    // one more does not fit the 16-bit count and is refused instead of cut
+    uint8_t out[4] = {0xEE, 0xEE, 0xEE, 0xEE};
+    TEST_ASSERT_EQUAL(0, encodeDmpStream(c.in, n + 1, out));
+    TEST_ASSERT_EQUAL(0xEE, out[0]);
+}
+
+int main(int, char **) {
+    UNITY_BEGIN();
+    RUN_TEST(test_drain_fills_the_block_in_bursts);
+    RUN_TEST(test_round_trip_is_exact_for_any_int32);
+    RUN_TEST(test_smooth_columns_pack_tightly);
+    RUN_TEST(test_truncated_and_malformed_streams_are_rejected);
+    RUN_TEST(test_sample_count_limit);
+    return UNITY_END();
+}
@@ -0,0 +1,155 @@
+// SpscRing and the Pipeline.h hand-off on the host: single-thread behaviour, a two-thread stress test and a
+// throughput benchmark. pio test -e native -f test_spsc_ring
+
+#include <unity.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include "Pipeline.h"
+#include "SpscRing.h"
+
+void setUp() {}
+void tearDown() {}
+
+void test_push_pop_wraps_around() {
+    SpscRing<uint32_t, 8> ring;
+    uint32_t out[8];
+    uint32_t next = 0, expected = 0;
+    for (int round = 0; round < 10; round++) { // 5 in, 5 out: head and tail keep crossing the end of the array
+        for (int i = 0; i < 5; i++) TEST_ASSERT_TRUE(ring.push(next++));
+        TEST_ASSERT_EQUAL(5, ring.size());
+        size_t n = ring.popSpan(out, 8);
+        TEST_ASSERT_EQUAL(5, n);
+        for (size_t i = 0; i < n; i++) TEST_ASSERT_EQUAL(expected++, out[i]);
+    }
+    TEST_ASSERT_EQUAL(0, ring.size());
+    TEST_ASSERT_EQUAL(0, ring.overflowCount());
+}
+
+void test_full_ring_counts_overflows() {
+    SpscRing<uint32_t, 4> ring;
+    for (uint32_t i = 0; i < 4; i++) TEST_ASSERT_TRUE(ring.push(i));
+    TEST_ASSERT_FALSE(ring.push(4));
+    TEST_ASSERT_FALSE(ring.push(5));
+    TEST_ASSERT_EQUAL(2, ring.overflowCount());
+    TEST_ASSERT_EQUAL(4, ring.highWaterMark());
+
+    TEST_ASSERT_EQUAL(2, *ring.peek(2));
+    TEST_ASSERT_NULL(ring.peek(4));
+    uint32_t sum = 0;
+    TEST_ASSERT_EQUAL(3, ring.consume(3, [&sum](const uint32_t &v) { sum += v; }));
+    TEST_ASSERT_EQUAL(0 + 1 + 2, sum);
+    TEST_ASSERT_TRUE(ring.push(6));
+    TEST_ASSERT_EQUAL(2, ring.size());
+}
+
+// Producer and consumer on their own threads, the producer retries on a full ring: every item has to arrive once and in order
+void test_two_thread_stress() {
+    const uint32_t ITEMS = 2000000;
+    static SpscRing<uint32_t, 256> ring;
+    std::thread producer([] {
+        for (uint32_t i = 0; i < ITEMS;) {
+            if (ring.push(i)) i++;
+            else std::this_thread::yield();
+        }
+    });
+
+    uint32_t out[64];
+    uint32_t expected = 0;
+    bool inOrder = true;
+    while (expected < ITEMS) {
+        size_t n = ring.popSpan(out, 64);
+        for (size_t i = 0; i < n; i++) inOrder &= out[i] == expected++;
+        if (n == 0) std::this_thread::yield();
+    }
+    producer.join();
+
+    TEST_ASSERT_TRUE(inOrder);
+    TEST_ASSERT_EQUAL(0, ring.size());
+    TEST_ASSERT_LESS_OR_EQUAL(256, ring.highWaterMark());
+}
+
+// The sampler never waits: what does not fit is dropped and counted, the rest reaches the compressor in order
+void test_pipeline_handoff() {
+    const size_t PACKET = 100;
+    const uint32_t PACKETS = 2000;
+    static SpscRing<uint32_t, 512> ring;
+    ThreadSignal signal;
+    StageStats samplerStats = {}, compressorStats = {};
+    std::atomic<bool> done(false);
+
+    std::thread sampler([&] {
+        uint32_t next = 0;
+        for (uint32_t p = 0; p < PACKETS; p++) {
+            produceSamples(ring, signal, samplerStats, PACKET, [&](SpscRing<uint32_t, 512> &r) {
+                for (size_t i = 0; i < PACKET; i++) r.push(next++);
+            });
+        }
+        done = true;
+        signal.notify();
+    });
+
+    uint32_t received = 0, last = 0;
+    bool increasing = true;
+    for (;;) {
+        bool finished = done;
+        bool got = consumePacket(ring, signal, compressorStats, PACKET, [&](SpscRing<uint32_t, 512> &r) {
+            uint32_t out[PACKET];
+            size_t n = r.popSpan(out, PACKET);
+            for (size_t i = 0; i < n; i++) {
+                if (received > 0 && out[i] <= last) increasing = false;
+                last = out[i];
+                received++;
+            }
+        }, 10);
+        if (!got && finished) break;
+    }
+    sampler.join();
+    received += (uint32_t)ring.size(); // less than a packet left over
+
+    TEST_ASSERT_TRUE(increasing);
+    TEST_ASSERT_EQUAL(PACKETS * PACKET, received + ring.overflowCount());
+    TEST_ASSERT_EQUAL(PACKETS, samplerStats.items);
+    TEST_ASSERT_EQUAL((PACKETS * PACKET - ring.overflowCount()) / PACKET, compressorStats.items);
+}
+
+// Items per second through the ring with one producer and one consumer thread, popSpan in bursts of 64
+void test_throughput_benchmark() {
+    const uint32_t ITEMS = 4000000;
+    static SpscRing<uint32_t, 1024> ring;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::thread producer([] {
+        for (uint32_t i = 0; i < ITEMS;) {
+            if (ring.push(i)) i++;
+            else std::this_thread::yield(); // on a single core the consumer has to get a turn
+        }
+    });
+
+    uint32_t out[64];
+    uint32_t received = 0;
+    uint64_t sum = 0;
+    while (received < ITEMS) {
+        size_t n = ring.popSpan(out, 64);
+        for (size_t i = 0; i < n; i++) sum += out[i];
+        received += (uint32_t)n;
+        if (n == 0) std::this_thread::yield();
+    }
+    producer.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    char line[96];
+    snprintf(line, sizeof(line), "SpscRing: %.1f M items/s (%u items in %.3f s)", ITEMS / seconds / 1e6, ITEMS, seconds);
+    TEST_MESSAGE(line);
+    TEST_ASSERT_TRUE(sum == (uint64_t)ITEMS * (ITEMS - 1) / 2); // every item arrived exactly once
+}
+
+int main(int, char **) {
+    UNITY_BEGIN();
+    RUN_TEST(test_push_pop_wraps_around);
+    RUN_TEST(test_full_ring_counts_overflows);
+    RUN_TEST(test_two_thread_stress);
+    RUN_TEST(test_pipeline_handoff);
+    RUN_TEST(test_throughput_benchmark);
+    return UNITY_END();
+}